@@ -29,9 +29,11 @@
 #include "Exceptions/IncorrectAttributeTypeException.hpp"
 #include "Exceptions/OperationNotSupportedException.hpp"
 #include "Exceptions/RuntimeException.hpp"
+#include "Expected.hpp"
 #include "Java/Archive/Jar.hpp"
 #include "Java/ByteCode/Instruction.hpp"
 #include "Java/ByteCode/OpCodes.hpp"
+#include "Java/ClassFile/AttributeFilter.hpp"
 #include "Java/ClassFile/Attributes/Annotation/Annotation.hpp"
 #include "Java/ClassFile/Attributes/Annotation/ElementValue.hpp"
 #include "Java/ClassFile/Attributes/Annotation/ElementValuePair.hpp"
@@ -40,6 +42,7 @@
 #include "Java/ClassFile/Attributes/AnnotationDefault.hpp"
 #include "Java/ClassFile/Attributes/Attribute.hpp"
 #include "Java/ClassFile/Attributes/AttributeInfo.hpp"
+#include "Java/ClassFile/Attributes/AttributeKind.hpp"
 #include "Java/ClassFile/Attributes/BootstrapMethods.hpp"
 #include "Java/ClassFile/Attributes/Code.hpp"
 #include "Java/ClassFile/Attributes/ConstantValue.hpp"
@@ -62,16 +65,30 @@
 #include "Java/ClassFile/Attributes/SourceFile.hpp"
 #include "Java/ClassFile/Attributes/StackMapTable.hpp"
 #include "Java/ClassFile/Attributes/Synthetic.hpp"
+#include "Java/ClassFile/ClassHeader.hpp"
 #include "Java/ClassFile/ClassInfo.hpp"
+#include "Java/ClassFile/ClassInfoParser.hpp"
+#include "Java/ClassFile/ClassReader.hpp"
+#include "Java/ClassFile/ClassVisitor.hpp"
 #include "Java/ClassFile/ConstantPool.hpp"
+#include "Java/ClassFile/ConstantPoolBuilder.hpp"
 #include "Java/ClassFile/ConstantPoolEntry.hpp"
 #include "Java/ClassFile/FieldDescriptor.hpp"
 #include "Java/ClassFile/FieldInfo.hpp"
 #include "Java/ClassFile/MethodDescriptor.hpp"
 #include "Java/ClassFile/MethodInfo.hpp"
+#include "Java/ClassFile/ParserContext.hpp"
+#include "Java/ClassFile/ResolutionCache.hpp"
+#include "Java/ClassFile/SymbolTable.hpp"
 #include "Java/ClassFile/Utils/AttributeInfoUtils.hpp"
 #include "Java/ClassFile/Utils/ClassInfoUtils.hpp"
 #include "Java/ClassFile/Utils/ConstantPoolEntryUtils.hpp"
+#include "Java/ClassFile/Utils/ModifiedUtf8Utils.hpp"
+#include "Stream/ByteBuffer.hpp"
+#include "Stream/ByteCursor.hpp"
+#include "Stream/ByteSwap.hpp"
+#include "Stream/MappedFile.hpp"
+#include "Stream/ReadError.hpp"
 #include "Stream/Reader.hpp"
 // #include "Stream/StandardStreamWrapper.hpp"
 #include "Stream/Stream.hpp"
@@ -0,0 +1,136 @@
+/*
+ * Expected.hpp
+ *
+ * Copyright © 2024 AeroJet Developers. All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the “Software”), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+ * OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+namespace AeroJet
+{
+    /**
+     * Wrapper used to construct Expected holding an error
+     */
+    template<typename E>
+    class Unexpected
+    {
+      public:
+        explicit Unexpected(E error) :
+            m_error(std::move(error))
+        {
+        }
+
+        [[nodiscard]] const E& error() const&
+        {
+            return m_error;
+        }
+
+        [[nodiscard]] E&& error() &&
+        {
+            return std::move(m_error);
+        }
+
+      private:
+        E m_error;
+    };
+
+    /**
+     * Holds either a value or an error describing why the value could not be produced.
+     * Lightweight replacement for std::expected, which is not available in C++20.
+     */
+    template<typename T, typename E>
+    class Expected
+    {
+      public:
+        Expected(T value) :
+            m_storage(std::in_place_index<0>, std::move(value))
+        {
+        }
+
+        Expected(Unexpected<E> error) :
+            m_storage(std::in_place_index<1>, std::move(error).error())
+        {
+        }
+
+        [[nodiscard]] bool hasValue() const
+        {
+            return m_storage.index() == 0;
+        }
+
+        explicit operator bool() const
+        {
+            return hasValue();
+        }
+
+        /**
+         * @throws std::bad_variant_access if Expected holds an error
+         */
+        [[nodiscard]] T& value() &
+        {
+            return std::get<0>(m_storage);
+        }
+
+        [[nodiscard]] const T& value() const&
+        {
+            return std::get<0>(m_storage);
+        }
+
+        [[nodiscard]] T&& value() &&
+        {
+            return std::get<0>(std::move(m_storage));
+        }
+
+        /**
+         * @throws std::bad_variant_access if Expected holds a value
+         */
+        [[nodiscard]] const E& error() const
+        {
+            return std::get<1>(m_storage);
+        }
+
+        T* operator->()
+        {
+            return &value();
+        }
+
+        const T* operator->() const
+        {
+            return &value();
+        }
+
+        T& operator*() &
+        {
+            return value();
+        }
+
+        const T& operator*() const&
+        {
+            return value();
+        }
+
+      private:
+        std::variant<T, E> m_storage;
+    };
+} // namespace AeroJet
@@ -25,10 +25,12 @@
 #pragma once
 
 #include "Stream/Stream.hpp"
+#include "Types.hpp"
 #include "zip.h"
 
 #include <filesystem>
 #include <string_view>
+#include <vector>
 
 namespace AeroJet::Java::Archive
 {
@@ -44,6 +46,16 @@ namespace AeroJet::Java::Archive
 
             [[nodiscard]] Stream::MemoryStream read() const;
 
+            /**
+             * @brief Decompresses the entry into a contiguous buffer, suitable for ClassInfo::load
+             */
+            [[nodiscard]] std::vector<u1> bytes() const;
+
+            /**
+             * @brief Decompresses the entry into given buffer, reusing its capacity
+             */
+            void readInto(std::vector<u1>& buffer) const;
+
             [[nodiscard]] std::string_view name() const;
 
             [[nodiscard]] ssize_t index() const;
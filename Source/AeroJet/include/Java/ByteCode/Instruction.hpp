@@ -25,8 +25,14 @@
 #pragma once
 
 #include "OpCodes.hpp"
+#include "Stream/ByteBuffer.hpp"
+#include "Stream/ByteCursor.hpp"
+#include "Stream/ReadError.hpp"
 #include "Types.hpp"
+#include "Utils/TableView.hpp"
 
+#include <memory_resource>
+#include <span>
 #include <vector>
 
 namespace AeroJet::Java::ByteCode
@@ -38,12 +44,35 @@ namespace AeroJet::Java::ByteCode
 
         Instruction(OperationCode opCode, std::vector<u1>&& data);
 
+        /**
+         * @brief Copies the operands into a buffer allocated from memoryResource
+         */
+        Instruction(OperationCode opCode, std::span<const u1> data, std::pmr::memory_resource* memoryResource);
+
+        /**
+         * @brief Decodes the instruction at the cursor, Stream::Reader::tryRead<Instruction> is equivalent
+         * @param operands scratch buffer the operands are assembled in, reused by callers which decode many instructions
+         * @param memoryResource backs the operands of the instruction
+         */
+        [[nodiscard]] static Stream::ReadResult<Instruction> tryRead(
+            Stream::ByteCursor& cursor,
+            Stream::ByteBuffer& operands,
+            std::pmr::memory_resource* memoryResource = std::pmr::get_default_resource());
+
+        /**
+         * @brief Throwing counterpart of tryRead(), Stream::Reader::read<Instruction> is equivalent
+         * @throws Exceptions::OperationNotSupportedException if the opcode is unknown
+         */
+        [[nodiscard]] static Instruction read(Stream::ByteCursor& cursor,
+                                              Stream::ByteBuffer& operands,
+                                              std::pmr::memory_resource* memoryResource = std::pmr::get_default_resource());
+
         [[nodiscard]] OperationCode opCode() const;
 
-        [[nodiscard]] const std::vector<u1>& data() const;
+        [[nodiscard]] AeroJet::Utils::TableView<u1> data() const;
 
       protected:
         OperationCode m_opCode;
-        std::vector<u1> m_data;
+        std::pmr::vector<u1> m_data;
     };
 } // namespace AeroJet::Java::ByteCode
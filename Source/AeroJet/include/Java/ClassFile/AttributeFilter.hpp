@@ -0,0 +1,100 @@
+/*
+ * AttributeFilter.hpp
+ *
+ * Copyright © 2024 AeroJet Developers. All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the “Software”), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+ * OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include "Java/ClassFile/Attributes/AttributeInfo.hpp"
+#include "Java/ClassFile/ConstantPool.hpp"
+#include "Java/ClassFile/SymbolTable.hpp"
+#include "Stream/ByteCursor.hpp"
+#include "Stream/ReadError.hpp"
+#include "Types.hpp"
+
+#include <initializer_list>
+#include <memory_resource>
+#include <string_view>
+#include <vector>
+
+namespace AeroJet::Java::ClassFile
+{
+    /**
+     * Selects attributes which are materialized as AttributeInfo while parsing. Names are interned into
+     * SymbolTable::global(), so matching an attribute is a comparison of symbol ids of the constant pool.
+     * Rejected attributes are skipped by their length and never copied.
+     *
+     * A default constructed filter keeps every attribute, use none() for a filter which drops them all.
+     */
+    class AttributeFilter
+    {
+      public:
+        AttributeFilter() = default;
+
+        /**
+         * @param names attribute names to keep
+         */
+        AttributeFilter(std::initializer_list<std::string_view> names);
+
+        explicit AttributeFilter(const std::vector<std::string_view>& names);
+
+        /**
+         * @brief Filter which keeps every attribute, used by default
+         */
+        [[nodiscard]] static const AttributeFilter& all();
+
+        /**
+         * @brief Filter which drops every attribute, e.g. to scan only names and descriptors of members
+         */
+        [[nodiscard]] static const AttributeFilter& none();
+
+        [[nodiscard]] bool keepsAll() const;
+
+        [[nodiscard]] bool keeps(SymbolId name) const;
+
+        [[nodiscard]] bool keeps(std::string_view name) const;
+
+        /**
+         * @brief Matches the name of an attribute by its index. Indices which do not refer to a UTF-8 entry are
+         * never kept, unless the filter keeps every attribute.
+         */
+        [[nodiscard]] bool keeps(const ConstantPool& constantPool, u2 nameIndex) const;
+
+        /**
+         * @brief Reads attributesCount attributes at the cursor and returns the kept ones in file order
+         * @param resolver resolves names and kinds of the attributes, may be null if keepsAll(), in which case
+         * kinds are AttributeKind::UNKNOWN
+         * @param memoryResource backs the returned table, and the payloads copied when the cursor has no owner
+         */
+        [[nodiscard]] Stream::ReadResult<std::pmr::vector<AttributeInfo>> tryRead(
+            Stream::ByteCursor& cursor,
+            u2 attributesCount,
+            AttributeKindResolver* resolver,
+            std::pmr::memory_resource* memoryResource = std::pmr::get_default_resource()) const;
+
+      protected:
+        bool m_keepsAll = true;
+
+        // Sorted, attribute names are few so a binary search beats hashing
+        std::vector<SymbolId> m_names;
+    };
+} // namespace AeroJet::Java::ClassFile
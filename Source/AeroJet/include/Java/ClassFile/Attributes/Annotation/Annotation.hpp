@@ -26,8 +26,11 @@
 
 #include "Java/ClassFile/Attributes/Annotation/ElementValue.hpp"
 #include "Java/ClassFile/Attributes/Annotation/ElementValuePair.hpp"
+#include "Stream/ByteCursor.hpp"
 #include "Types.hpp"
+#include "Utils/TableView.hpp"
 
+#include <memory_resource>
 #include <vector>
 
 namespace AeroJet::Java::ClassFile
@@ -37,6 +40,14 @@ namespace AeroJet::Java::ClassFile
       public:
         Annotation(u2 typeIndex, const std::vector<ElementValuePair>& elementValuePairs);
 
+        Annotation(u2 typeIndex, std::pmr::vector<ElementValuePair> elementValuePairs);
+
+        /**
+         * @brief Reads annotation at the cursor, Stream::Reader::read<Annotation> uses the default resource
+         * @param memoryResource backs the element-value pairs and their values
+         */
+        [[nodiscard]] static Annotation read(Stream::ByteCursor& cursor, std::pmr::memory_resource* memoryResource);
+
         /**
          * The value of the type_index item must be a valid index into the constant_pool table.
          * The constant_pool entry at that index must be a CONSTANT_Utf8_info structure (§4.4.7)
@@ -55,10 +66,10 @@ namespace AeroJet::Java::ClassFile
          * Each value of the element_value_pairs table represents a single element-value pair in the annotation
          * represented by this annotation structure.
          */
-        [[nodiscard]] const std::vector<ElementValuePair>& elementValuePairs() const;
+        [[nodiscard]] AeroJet::Utils::TableView<ElementValuePair> elementValuePairs() const;
 
       private:
         u2 m_typeIndex;
-        std::vector<ElementValuePair> m_elementValuePairs;
+        std::pmr::vector<ElementValuePair> m_elementValuePairs;
     };
 } // namespace AeroJet::Java::ClassFile
\ No newline at end of file
@@ -24,9 +24,12 @@
 
 #pragma once
 
+#include "Stream/ByteCursor.hpp"
 #include "Types.hpp"
+#include "Utils/TableView.hpp"
 
 #include <memory>
+#include <memory_resource>
 #include <variant>
 #include <vector>
 
@@ -72,17 +75,25 @@ namespace AeroJet::Java::ClassFile
           public:
             explicit ArrayValue(const std::vector<ElementValue>& values);
 
+            explicit ArrayValue(std::pmr::vector<ElementValue> values);
+
             [[nodiscard]] u2 numValues() const;
-            [[nodiscard]] const std::vector<ElementValue>& values() const;
+            [[nodiscard]] AeroJet::Utils::TableView<ElementValue> values() const;
 
           private:
-            std::vector<ElementValue> m_values;
+            std::pmr::vector<ElementValue> m_values;
         };
 
         using Value = std::variant<u2, EnumConstValue, std::shared_ptr<Annotation>, ArrayValue>;
 
         ElementValue(Tag tag, Value value);
 
+        /**
+         * @brief Reads element_value at the cursor, Stream::Reader::read<ElementValue> uses the default resource
+         * @param memoryResource backs the values of arrays and nested annotations
+         */
+        [[nodiscard]] static ElementValue read(Stream::ByteCursor& cursor, std::pmr::memory_resource* memoryResource);
+
         [[nodiscard]] Tag tag() const;
         [[nodiscard]] const Value& value() const;
 
@@ -31,7 +31,12 @@ namespace AeroJet::Java::ClassFile
     class ElementValuePair
     {
       public:
-        ElementValuePair(u2 elementNameIndex, const ElementValue& value);
+        ElementValuePair(u2 elementNameIndex, ElementValue value);
+
+        /**
+         * @param memoryResource backs the tables of the value
+         */
+        [[nodiscard]] static ElementValuePair read(Stream::ByteCursor& cursor, std::pmr::memory_resource* memoryResource);
 
         /**
          * The value of the element_name_index item must be a valid index into the constant_pool table.
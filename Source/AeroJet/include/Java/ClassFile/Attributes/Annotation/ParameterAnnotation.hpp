@@ -26,6 +26,7 @@
 
 #include "Java/ClassFile/Attributes/Annotation/Annotation.hpp"
 
+#include <memory_resource>
 #include <vector>
 
 namespace AeroJet::Java::ClassFile
@@ -35,6 +36,15 @@ namespace AeroJet::Java::ClassFile
       public:
         explicit ParameterAnnotation(const std::vector<Annotation>& annotations);
 
+        explicit ParameterAnnotation(std::pmr::vector<Annotation> annotations);
+
+        /**
+         * @brief Reads parameter_annotations entry at the cursor, Stream::Reader::read<ParameterAnnotation> uses the
+         * default resource
+         * @param memoryResource backs the annotations
+         */
+        [[nodiscard]] static ParameterAnnotation read(Stream::ByteCursor& cursor, std::pmr::memory_resource* memoryResource);
+
         /**
          * The value of the num_annotations item indicates the number of run-time visible annotations on the declaration
          * of the formal parameter corresponding to the parameter_annotations entry.
@@ -46,9 +56,9 @@ namespace AeroJet::Java::ClassFile
          * formal parameter corresponding to the parameter_annotations entry.
          * The annotation structure is specified in §4.7.16.
          */
-        [[nodiscard]] const std::vector<Annotation>& annotations() const;
+        [[nodiscard]] AeroJet::Utils::TableView<Annotation> annotations() const;
 
       private:
-        std::vector<Annotation> m_annotations;
+        std::pmr::vector<Annotation> m_annotations;
     };
 } // namespace AeroJet::Java::ClassFile
\ No newline at end of file
@@ -26,7 +26,10 @@
 
 #include "Java/ClassFile/Attributes/Annotation/ElementValue.hpp"
 #include "Java/ClassFile/Attributes/Annotation/ElementValuePair.hpp"
+#include "Stream/ByteCursor.hpp"
+#include "Utils/TableView.hpp"
 
+#include <memory_resource>
 #include <variant>
 #include <vector>
 
@@ -195,12 +198,19 @@ namespace AeroJet::Java::ClassFile
 
         explicit LocalVarTarget(std::vector<TableEntry> table);
 
+        explicit LocalVarTarget(std::pmr::vector<TableEntry> table);
+
+        /**
+         * @brief Reads localvar_target at the cursor, Stream::Reader::read<LocalVarTarget> uses the default resource
+         */
+        [[nodiscard]] static LocalVarTarget read(Stream::ByteCursor& cursor, std::pmr::memory_resource* memoryResource);
+
         [[nodiscard]] u2 tableLength() const;
 
-        [[nodiscard]] const std::vector<TableEntry>& table() const;
+        [[nodiscard]] AeroJet::Utils::TableView<TableEntry> table() const;
 
       private:
-        std::vector<TableEntry> m_table;
+        std::pmr::vector<TableEntry> m_table;
     };
 
     /**
@@ -353,6 +363,13 @@ namespace AeroJet::Java::ClassFile
 
         explicit TypePath(std::vector<Path> path);
 
+        explicit TypePath(std::pmr::vector<Path> path);
+
+        /**
+         * @brief Reads type_path at the cursor, Stream::Reader::read<TypePath> uses the default resource
+         */
+        [[nodiscard]] static TypePath read(Stream::ByteCursor& cursor, std::pmr::memory_resource* memoryResource);
+
         /**
          * The value of the path_length item gives the number of entries in the path array:
          *
@@ -366,10 +383,10 @@ namespace AeroJet::Java::ClassFile
          */
         [[nodiscard]] u1 pathLength() const;
 
-        [[nodiscard]] const std::vector<Path>& path() const;
+        [[nodiscard]] AeroJet::Utils::TableView<Path> path() const;
 
       private:
-        std::vector<Path> m_path;
+        std::pmr::vector<Path> m_path;
     };
 
     class TypeAnnotation
@@ -381,6 +398,18 @@ namespace AeroJet::Java::ClassFile
                        u2 typeIndex,
                        const std::vector<ElementValuePair>& elementValuePairs);
 
+        TypeAnnotation(u1 targetType,
+                       TargetInfo targetInfo,
+                       TypePath targetPath,
+                       u2 typeIndex,
+                       std::pmr::vector<ElementValuePair> elementValuePairs);
+
+        /**
+         * @brief Reads type_annotation at the cursor, Stream::Reader::read<TypeAnnotation> uses the default resource
+         * @param memoryResource backs the target, the path and the element-value pairs
+         */
+        [[nodiscard]] static TypeAnnotation read(Stream::ByteCursor& cursor, std::pmr::memory_resource* memoryResource);
+
         /**
          * The value of the target_type item denotes the kind of target on which the annotation appears.
          * The various kinds of target correspond to the type contexts of the Java programming language where types
@@ -423,13 +452,13 @@ namespace AeroJet::Java::ClassFile
          */
         [[nodiscard]] u2 typeIndex() const;
         [[nodiscard]] u2 numElementValuePairs() const;
-        [[nodiscard]] const std::vector<ElementValuePair>& elementValuePairs() const;
+        [[nodiscard]] AeroJet::Utils::TableView<ElementValuePair> elementValuePairs() const;
 
       private:
         u1 m_targetType;
         TargetInfo m_targetInfo;
         TypePath m_targetPath;
         u2 m_typeIndex;
-        std::vector<ElementValuePair> m_elementValuePairs;
+        std::pmr::vector<ElementValuePair> m_elementValuePairs;
     };
 } // namespace AeroJet::Java::ClassFile
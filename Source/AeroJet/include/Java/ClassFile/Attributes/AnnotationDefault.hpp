@@ -27,6 +27,8 @@
 #include "Java/ClassFile/Attributes/Annotation/ElementValue.hpp"
 #include "Java/ClassFile/Attributes/Attribute.hpp"
 
+#include <memory_resource>
+
 namespace AeroJet::Java::ClassFile
 {
     /**
@@ -44,7 +46,12 @@ namespace AeroJet::Java::ClassFile
       public:
         static constexpr auto ANNOTATION_DEFAULT_ATTRIBUTE_NAME = "AnnotationDefault";
 
-        AnnotationDefault(const ConstantPool& constantPool, const AttributeInfo& attributeInfo);
+        /**
+         * @param memoryResource backs the tables of the default value
+         */
+        AnnotationDefault(const ConstantPool& constantPool,
+                          const AttributeInfo& attributeInfo,
+                          std::pmr::memory_resource* memoryResource = std::pmr::get_default_resource());
 
         /**
          * The default_value item represents the default value of the annotation type element represented by the
@@ -25,20 +25,28 @@
 #pragma once
 
 #include "AttributeInfo.hpp"
+#include "AttributeKind.hpp"
 #include "Java/ClassFile/ConstantPool.hpp"
+#include "Stream/ByteCursor.hpp"
 #include "Types.hpp"
 
-#include <sstream>
 #include <string>
 
 namespace AeroJet::Java::ClassFile
 {
+    /**
+     * Base of the typed attributes. Subclasses parse their payload through m_infoCursor, which reads the bytes of
+     * the AttributeInfo in place and shares ownership of the buffer they live in.
+     */
     class Attribute
     {
       public:
+        /**
+         * @throws Exceptions::IncorrectAttributeTypeException if attributeInfo is not of requiredKind
+         */
         Attribute(const ConstantPool& constantPool,
                   const AttributeInfo& attributeInfo,
-                  std::string_view requiredAttributeName);
+                  AttributeKind requiredKind);
 
         [[nodiscard]] u2 attributeNameIndex() const;
 
@@ -47,6 +55,6 @@ namespace AeroJet::Java::ClassFile
       protected:
         u2 m_attributeNameIndex;
         u4 m_attributeLength;
-        Stream::MemoryStream m_infoDataStream;
+        Stream::ByteCursor m_infoCursor;
     };
 } // namespace AeroJet::Java::ClassFile
\ No newline at end of file
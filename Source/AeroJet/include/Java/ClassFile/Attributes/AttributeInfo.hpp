@@ -24,8 +24,12 @@
 
 #pragma once
 
+#include "Java/ClassFile/Attributes/AttributeKind.hpp"
 #include "Types.hpp"
 
+#include <memory>
+#include <memory_resource>
+#include <span>
 #include <vector>
 
 namespace AeroJet::Java::ClassFile
@@ -43,21 +47,57 @@ namespace AeroJet::Java::ClassFile
      * }
      *
      * @see https://docs.oracle.com/javase/specs/jvms/se8/html/jvms-4.html#jvms-4.7
+     *
+     * The info payload is either owned by the AttributeInfo or borrowed from the buffer of the class it was read from.
+     * Borrowed payloads share ownership of that buffer, so they stay valid as long as the AttributeInfo is alive.
+     *
+     * The kind of the attribute is resolved from its name when it is read together with its constant pool.
      */
 
     class AttributeInfo
     {
       public:
-        AttributeInfo(u2 attributeIndex, std::vector<u1> info);
+        AttributeInfo(u2 attributeIndex, std::vector<u1> info, AttributeKind kind = AttributeKind::UNKNOWN);
+
+        AttributeInfo(u2 attributeIndex,
+                      std::span<const u1> info,
+                      std::shared_ptr<const void> storage,
+                      AttributeKind kind = AttributeKind::UNKNOWN);
+
+        /**
+         * @brief Copies the info payload into a buffer allocated from memoryResource
+         */
+        AttributeInfo(u2 attributeIndex,
+                      std::span<const u1> info,
+                      std::pmr::memory_resource* memoryResource,
+                      AttributeKind kind = AttributeKind::UNKNOWN);
 
         [[nodiscard]] u2 attributeNameIndex() const;
 
+        /**
+         * @brief Kind resolved at parse time, AttributeKind::UNKNOWN if the attribute is non-standard or was read
+         * without a constant pool
+         */
+        [[nodiscard]] AttributeKind kind() const;
+
         [[nodiscard]] u2 size() const;
 
-        [[nodiscard]] const std::vector<u1>& info() const;
+        [[nodiscard]] std::span<const u1> info() const;
+
+        /**
+         * @brief Storage which owns the info payload
+         */
+        [[nodiscard]] const std::shared_ptr<const void>& storage() const;
+
+        /**
+         * @brief Copies the info payload into a newly allocated buffer
+         */
+        [[nodiscard]] std::vector<u1> copyInfo() const;
 
       protected:
         u2 m_attributeNameIndex;
-        std::vector<u1> m_info;
+        AttributeKind m_kind;
+        std::shared_ptr<const void> m_storage;
+        std::span<const u1> m_info;
     };
 } // namespace AeroJet::Java::ClassFile
@@ -0,0 +1,148 @@
+/*
+ * AttributeKind.hpp
+ *
+ * Copyright © 2024 AeroJet Developers. All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the “Software”), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+ * OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include "Java/ClassFile/ConstantPool.hpp"
+#include "Java/ClassFile/SymbolTable.hpp"
+#include "Types.hpp"
+
+#include <array>
+#include <cstddef>
+#include <memory_resource>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace AeroJet::Java::ClassFile
+{
+    class AttributeInfo;
+
+    /**
+     * Predefined attributes of the class file format (§4.7), so that the kind of an attribute is compared as an
+     * integer instead of by its name.
+     */
+    enum class AttributeKind : u1
+    {
+        /**
+         * Non-standard attribute, or attribute read without a constant pool to resolve its name
+         */
+        UNKNOWN,
+        CONSTANT_VALUE,
+        CODE,
+        STACK_MAP_TABLE,
+        BOOTSTRAP_METHODS,
+        NEST_HOST,
+        NEST_MEMBERS,
+        PERMITTED_SUBCLASSES,
+        EXCEPTIONS,
+        INNER_CLASSES,
+        ENCLOSING_METHOD,
+        SYNTHETIC,
+        SIGNATURE,
+        RECORD,
+        SOURCE_FILE,
+        LINE_NUMBER_TABLE,
+        LOCAL_VARIABLE_TABLE,
+        LOCAL_VARIABLE_TYPE_TABLE,
+        SOURCE_DEBUG_EXTENSION,
+        DEPRECATED,
+        RUNTIME_VISIBLE_ANNOTATIONS,
+        RUNTIME_INVISIBLE_ANNOTATIONS,
+        RUNTIME_VISIBLE_PARAMETER_ANNOTATIONS,
+        RUNTIME_INVISIBLE_PARAMETER_ANNOTATIONS,
+        RUNTIME_VISIBLE_TYPE_ANNOTATIONS,
+        RUNTIME_INVISIBLE_TYPE_ANNOTATIONS,
+        ANNOTATION_DEFAULT,
+        METHOD_PARAMETERS,
+        MODULE,
+        MODULE_PACKAGES,
+        MODULE_MAIN_CLASS
+    };
+
+    inline constexpr std::size_t ATTRIBUTE_KIND_COUNT = static_cast<std::size_t>(AttributeKind::MODULE_MAIN_CLASS) + 1;
+
+    /**
+     * @brief Name of the attribute in the class file, empty for AttributeKind::UNKNOWN
+     */
+    [[nodiscard]] std::string_view attributeKindName(AttributeKind kind);
+
+    /**
+     * @brief Kind of the attribute with given name interned into SymbolTable::global()
+     */
+    [[nodiscard]] AttributeKind attributeKind(SymbolId name);
+
+    [[nodiscard]] AttributeKind attributeKind(std::string_view name);
+
+    /**
+     * Classifies attributes of one class by their name index. Each index is resolved once, further attributes with
+     * the same name cost a single load. Not thread-safe, meant to live for the duration of a parse.
+     */
+    class AttributeKindResolver
+    {
+      public:
+        explicit AttributeKindResolver(const ConstantPool& constantPool,
+                                       std::pmr::memory_resource* memoryResource = std::pmr::get_default_resource());
+
+        /**
+         * @brief Resolver which does not allocate and resolves every lookup anew, for tables with a handful of
+         * attributes such as the attributes of a Code
+         */
+        [[nodiscard]] static AttributeKindResolver uncached(const ConstantPool& constantPool);
+
+        [[nodiscard]] const ConstantPool& constantPool() const;
+
+        /**
+         * @return AttributeKind::UNKNOWN for non-standard names and indices which do not refer to a UTF-8 entry
+         */
+        [[nodiscard]] AttributeKind resolve(u2 nameIndex);
+
+      protected:
+        AttributeKindResolver(const ConstantPool& constantPool, bool caches);
+
+        const ConstantPool* m_constantPool;
+        bool m_caches;
+
+        // Kind + 1 for every constant pool slot, 0 until resolved
+        std::pmr::vector<u1> m_kinds;
+    };
+
+    /**
+     * Position of the first attribute of each kind in an attributes table, for constant time lookups.
+     */
+    class AttributeKindIndex
+    {
+      public:
+        AttributeKindIndex() = default;
+
+        explicit AttributeKindIndex(std::span<const AttributeInfo> attributes);
+
+        [[nodiscard]] std::optional<std::size_t> find(AttributeKind kind) const;
+
+      protected:
+        // Position + 1, 0 if there is no attribute of the kind
+        std::array<u2, ATTRIBUTE_KIND_COUNT> m_positions{};
+    };
+} // namespace AeroJet::Java::ClassFile
@@ -25,11 +25,14 @@
 #pragma once
 
 #include "Java/ByteCode/Instruction.hpp"
+#include "Java/ClassFile/AttributeFilter.hpp"
 #include "Java/ClassFile/Attributes/Attribute.hpp"
 #include "Java/ClassFile/Attributes/AttributeInfo.hpp"
 #include "Java/ClassFile/ConstantPool.hpp"
 #include "Types.hpp"
+#include "Utils/TableView.hpp"
 
+#include <memory_resource>
 #include <vector>
 
 namespace AeroJet::Java::ClassFile
@@ -60,23 +63,36 @@ namespace AeroJet::Java::ClassFile
         };
 
       public:
-        Code(const ConstantPool& constantPool, const AttributeInfo& attributeInfo);
+        /**
+         * @param attributeFilter selects attributes of the code to keep (LineNumberTable, StackMapTable...)
+         * @param memoryResource backs the instructions, the exception table and the attributes of the code
+         */
+        Code(const ConstantPool& constantPool,
+             const AttributeInfo& attributeInfo,
+             const AttributeFilter& attributeFilter = AttributeFilter::all(),
+             std::pmr::memory_resource* memoryResource = std::pmr::get_default_resource());
 
         [[nodiscard]] u2 maxStack() const;
 
         [[nodiscard]] u2 maxLocals() const;
 
-        [[nodiscard]] const std::vector<ByteCode::Instruction>& code() const;
+        [[nodiscard]] AeroJet::Utils::TableView<ByteCode::Instruction> code() const;
 
-        [[nodiscard]] const std::vector<Code::ExceptionTableEntry>& exceptionTable() const;
+        [[nodiscard]] AeroJet::Utils::TableView<Code::ExceptionTableEntry> exceptionTable() const;
 
-        [[nodiscard]] const std::vector<AttributeInfo>& attributes() const;
+        [[nodiscard]] AeroJet::Utils::TableView<AttributeInfo> attributes() const;
+
+        /**
+         * @brief First attribute of the code of given kind, found in constant time
+         */
+        [[nodiscard]] const AttributeInfo* findAttribute(AttributeKind kind) const;
 
       protected:
         u2 m_maxStack;
         u2 m_maxLocals;
-        std::vector<ByteCode::Instruction> m_code;
-        std::vector<ExceptionTableEntry> m_exceptionTable;
-        std::vector<AttributeInfo> m_attributes;
+        std::pmr::vector<ByteCode::Instruction> m_code;
+        std::pmr::vector<ExceptionTableEntry> m_exceptionTable;
+        std::pmr::vector<AttributeInfo> m_attributes;
+        AttributeKindIndex m_attributeIndex;
     };
 } // namespace AeroJet::Java::ClassFile
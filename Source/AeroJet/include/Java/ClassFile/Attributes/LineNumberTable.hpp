@@ -56,6 +56,8 @@ namespace AeroJet::Java::ClassFile
         [[nodiscard]] const std::vector<LineNumberTableEntry>& lineNumberTable() const;
 
       protected:
+        static constexpr std::size_t ENTRY_FIELDS_COUNT = 2;
+
         std::vector<LineNumberTableEntry> m_lineNumberTable;
     };
 } // namespace AeroJet::Java::ClassFile
\ No newline at end of file
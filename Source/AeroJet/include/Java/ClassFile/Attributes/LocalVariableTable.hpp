@@ -66,6 +66,8 @@ namespace AeroJet::Java::ClassFile
         [[nodiscard]] const std::vector<LocalVariableTableEntry>& localVariableTable() const;
 
       protected:
+        static constexpr std::size_t ENTRY_FIELDS_COUNT = 5;
+
         std::vector<LocalVariableTableEntry> m_localVariableTable;
     };
 } // namespace AeroJet::Java::ClassFile
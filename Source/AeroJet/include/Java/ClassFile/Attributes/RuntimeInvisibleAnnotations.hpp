@@ -26,7 +26,9 @@
 
 #include "Java/ClassFile/Attributes/Annotation/Annotation.hpp"
 #include "Java/ClassFile/Attributes/Attribute.hpp"
+#include "Utils/TableView.hpp"
 
+#include <memory_resource>
 #include <vector>
 
 namespace AeroJet::Java::ClassFile
@@ -50,7 +52,12 @@ namespace AeroJet::Java::ClassFile
       public:
         static constexpr auto RUNTIME_INVISIBLE_ANNOTATIONS_ATTRIBUTE_NAME = "RuntimeInvisibleAnnotations";
 
-        RuntimeInvisibleAnnotations(const ConstantPool& constantPool, const AttributeInfo& attributeInfo);
+        /**
+         * @param memoryResource backs the annotations and their tables
+         */
+        RuntimeInvisibleAnnotations(const ConstantPool& constantPool,
+                                    const AttributeInfo& attributeInfo,
+                                    std::pmr::memory_resource* memoryResource = std::pmr::get_default_resource());
 
         /**
          * The value of the num_annotations item gives the number of run-time visible annotations represented by
@@ -61,9 +68,9 @@ namespace AeroJet::Java::ClassFile
         /**
          * Each entry in the annotations table represents a single run-time visible annotation on a declaration.
          */
-        [[nodiscard]] const std::vector<Annotation>& annotations() const;
+        [[nodiscard]] AeroJet::Utils::TableView<Annotation> annotations() const;
 
       private:
-        std::vector<Annotation> m_annotations;
+        std::pmr::vector<Annotation> m_annotations;
     };
 } // namespace AeroJet::Java::ClassFile
\ No newline at end of file
@@ -26,7 +26,9 @@
 
 #include "Java/ClassFile/Attributes/Annotation/ParameterAnnotation.hpp"
 #include "Java/ClassFile/Attributes/Attribute.hpp"
+#include "Utils/TableView.hpp"
 
+#include <memory_resource>
 #include <vector>
 
 namespace AeroJet::Java::ClassFile
@@ -51,7 +53,12 @@ namespace AeroJet::Java::ClassFile
         static constexpr auto RUNTIME_INVISIBLE_PARAMETER_ANNOTATIONS_ATTRIBUTE_NAME =
             "RuntimeInvisibleParameterAnnotations";
 
-        RuntimeInvisibleParameterAnnotations(const ConstantPool& constantPool, const AttributeInfo& attributeInfo);
+        /**
+         * @param memoryResource backs the parameter annotations and their tables
+         */
+        RuntimeInvisibleParameterAnnotations(const ConstantPool& constantPool,
+                                             const AttributeInfo& attributeInfo,
+                                             std::pmr::memory_resource* memoryResource = std::pmr::get_default_resource());
 
         /**
          * The value of the num_parameters item gives the number of formal parameters of the method represented by the
@@ -64,9 +71,9 @@ namespace AeroJet::Java::ClassFile
          * the declaration of a single formal parameter. The i'th entry in the table corresponds to the i'th formal
          * parameter in the method descriptor (§4.3.3).
          */
-        [[nodiscard]] const std::vector<ParameterAnnotation>& parameterAnnotations() const;
+        [[nodiscard]] AeroJet::Utils::TableView<ParameterAnnotation> parameterAnnotations() const;
 
       private:
-        std::vector<ParameterAnnotation> m_parameterAnnotations;
+        std::pmr::vector<ParameterAnnotation> m_parameterAnnotations;
     };
 } // namespace AeroJet::Java::ClassFile
@@ -26,7 +26,9 @@
 
 #include "Java/ClassFile/Attributes/Annotation/TypeAnnotation.hpp"
 #include "Java/ClassFile/Attributes/Attribute.hpp"
+#include "Utils/TableView.hpp"
 
+#include <memory_resource>
 #include <vector>
 
 namespace AeroJet::Java::ClassFile
@@ -48,9 +50,14 @@ namespace AeroJet::Java::ClassFile
     class RuntimeInvisibleTyperAnnotations : public Attribute
     {
       public:
-        static constexpr auto RUNTIME_INVISIBLE_TYPE_ANNOTATIONS_ATTRIBUTE_NAME = "RuntimeInvisibleTyperAnnotations";
+        static constexpr auto RUNTIME_INVISIBLE_TYPE_ANNOTATIONS_ATTRIBUTE_NAME = "RuntimeInvisibleTypeAnnotations";
 
-        RuntimeInvisibleTyperAnnotations(const ConstantPool& constantPool, const AttributeInfo& attributeInfo);
+        /**
+         * @param memoryResource backs the annotations and their tables
+         */
+        RuntimeInvisibleTyperAnnotations(const ConstantPool& constantPool,
+                                         const AttributeInfo& attributeInfo,
+                                         std::pmr::memory_resource* memoryResource = std::pmr::get_default_resource());
 
         /**
          * The value of the num_annotations item gives the number of run-time invisible type annotations represented
@@ -62,9 +69,9 @@ namespace AeroJet::Java::ClassFile
          * Each entry in the annotations table represents a single run-time invisible annotation on a type used in a
          * declaration or expression. The type_annotation structure is specified in §4.7.20.
          */
-        [[nodiscard]] const std::vector<TypeAnnotation>& annotations() const;
+        [[nodiscard]] AeroJet::Utils::TableView<TypeAnnotation> annotations() const;
 
       private:
-        std::vector<TypeAnnotation> m_annotations;
+        std::pmr::vector<TypeAnnotation> m_annotations;
     };
 } // namespace AeroJet::Java::ClassFile
\ No newline at end of file
@@ -26,7 +26,9 @@
 
 #include "Java/ClassFile/Attributes/Annotation/Annotation.hpp"
 #include "Java/ClassFile/Attributes/Attribute.hpp"
+#include "Utils/TableView.hpp"
 
+#include <memory_resource>
 #include <vector>
 
 namespace AeroJet::Java::ClassFile
@@ -36,7 +38,12 @@ namespace AeroJet::Java::ClassFile
       public:
         static constexpr auto RUNTIME_VISIBLE_ANNOTATIONS_ATTRIBUTE_NAME = "RuntimeVisibleAnnotations";
 
-        RuntimeVisibleAnnotations(const ConstantPool& constantPool, const AttributeInfo& attributeInfo);
+        /**
+         * @param memoryResource backs the annotations and their tables
+         */
+        RuntimeVisibleAnnotations(const ConstantPool& constantPool,
+                                  const AttributeInfo& attributeInfo,
+                                  std::pmr::memory_resource* memoryResource = std::pmr::get_default_resource());
 
         /**
          * The value of the num_annotations item gives the number of run-time visible annotations represented by
@@ -47,9 +54,9 @@ namespace AeroJet::Java::ClassFile
         /**
          * Each entry in the annotations table represents a single run-time visible annotation on a declaration.
          */
-        [[nodiscard]] const std::vector<Annotation>& annotations() const;
+        [[nodiscard]] AeroJet::Utils::TableView<Annotation> annotations() const;
 
       private:
-        std::vector<Annotation> m_annotations;
+        std::pmr::vector<Annotation> m_annotations;
     };
 } // namespace AeroJet::Java::ClassFile
\ No newline at end of file
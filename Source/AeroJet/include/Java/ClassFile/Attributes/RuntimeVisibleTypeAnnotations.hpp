@@ -26,7 +26,9 @@
 
 #include "Java/ClassFile/Attributes/Annotation/TypeAnnotation.hpp"
 #include "Java/ClassFile/Attributes/Attribute.hpp"
+#include "Utils/TableView.hpp"
 
+#include <memory_resource>
 #include <vector>
 
 namespace AeroJet::Java::ClassFile
@@ -49,9 +51,14 @@ namespace AeroJet::Java::ClassFile
     class RuntimeVisibleTyperAnnotations : public Attribute
     {
       public:
-        static constexpr auto RUNTIME_VISIBLE_TYPE_ANNOTATIONS_ATTRIBUTE_NAME = "RuntimeVisibleTyperAnnotations";
+        static constexpr auto RUNTIME_VISIBLE_TYPE_ANNOTATIONS_ATTRIBUTE_NAME = "RuntimeVisibleTypeAnnotations";
 
-        RuntimeVisibleTyperAnnotations(const ConstantPool& constantPool, const AttributeInfo& attributeInfo);
+        /**
+         * @param memoryResource backs the annotations and their tables
+         */
+        RuntimeVisibleTyperAnnotations(const ConstantPool& constantPool,
+                                       const AttributeInfo& attributeInfo,
+                                       std::pmr::memory_resource* memoryResource = std::pmr::get_default_resource());
 
         /**
          * The value of the num_annotations item gives the number of run-time visible type annotations represented
@@ -63,9 +70,9 @@ namespace AeroJet::Java::ClassFile
          * Each entry in the annotations table represents a single run-time visible annotation on a type used in a
          * declaration or expression.
          */
-        [[nodiscard]] const std::vector<TypeAnnotation>& annotations() const;
+        [[nodiscard]] AeroJet::Utils::TableView<TypeAnnotation> annotations() const;
 
       private:
-        std::vector<TypeAnnotation> m_annotations;
+        std::pmr::vector<TypeAnnotation> m_annotations;
     };
 } // namespace AeroJet::Java::ClassFile
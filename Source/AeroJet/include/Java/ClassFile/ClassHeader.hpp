@@ -0,0 +1,133 @@
+/*
+ * ClassHeader.hpp
+ *
+ * Copyright © 2024 AeroJet Developers. All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the “Software”), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+ * OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include "Java/ClassFile/ClassInfo.hpp"
+#include "Java/ClassFile/ConstantPool.hpp"
+#include "Stream/ByteCursor.hpp"
+#include "Stream/ReadError.hpp"
+#include "Types.hpp"
+#include "Utils/TableView.hpp"
+
+#include <filesystem>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace AeroJet::Java::ClassFile
+{
+    /**
+     * Leading part of the ClassFile structure: versions, constant pool, access flags, this_class, super_class and
+     * interfaces. Parsing stops right after the interfaces table, fields, methods and attributes are never read,
+     * which is all that is needed to build a class hierarchy.
+     */
+    class ClassHeader
+    {
+      public:
+        ClassHeader(u2 minorVersion,
+                    u2 majorVersion,
+                    ConstantPool constantPool,
+                    u2 accessFlags,
+                    u2 thisClass,
+                    std::optional<u2> superClass,
+                    std::pmr::vector<u2> interfaces);
+
+        /**
+         * @brief Maps the class file at given path and parses its header.
+         * The constant pool is decoded lazily by default, as only the class names are usually looked up.
+         */
+        [[nodiscard]] static ClassHeader load(const std::filesystem::path& path,
+                                              ConstantPool::Decoding decoding = ConstantPool::Decoding::LAZY);
+
+        [[nodiscard]] static ClassHeader load(std::vector<u1> bytes,
+                                              ConstantPool::Decoding decoding = ConstantPool::Decoding::LAZY);
+
+        /**
+         * @brief Non-throwing counterpart of load(). Failure to open or map the file is still reported by exception.
+         */
+        [[nodiscard]] static Stream::ReadResult<ClassHeader> tryLoad(const std::filesystem::path& path,
+                                                                     ConstantPool::Decoding decoding = ConstantPool::Decoding::LAZY);
+
+        [[nodiscard]] static Stream::ReadResult<ClassHeader> tryLoad(std::vector<u1> bytes,
+                                                                     ConstantPool::Decoding decoding = ConstantPool::Decoding::LAZY);
+
+        /**
+         * @brief Parses the header at the cursor and leaves the cursor at fields_count.
+         * Stream::Reader::tryRead<ClassHeader> is equivalent to Decoding::EAGER.
+         * @param memoryResource backs the constant pool and the interfaces table
+         */
+        [[nodiscard]] static Stream::ReadResult<ClassHeader> tryRead(
+            Stream::ByteCursor& cursor,
+            ConstantPool::Decoding decoding,
+            std::pmr::memory_resource* memoryResource = std::pmr::get_default_resource());
+
+        [[nodiscard]] u2 minorVersion() const;
+
+        [[nodiscard]] u2 majorVersion() const;
+
+        [[nodiscard]] const ConstantPool& constantPool() const;
+
+        [[nodiscard]] ClassInfo::AccessFlags accessFlags() const;
+
+        [[nodiscard]] u2 thisClass() const;
+
+        /**
+         * @brief Index of the super class, empty for java/lang/Object
+         */
+        [[nodiscard]] std::optional<u2> superClass() const;
+
+        [[nodiscard]] AeroJet::Utils::TableView<u2> interfaces() const;
+
+        /**
+         * @brief Internal name of this class, like org/project/ClassName
+         */
+        [[nodiscard]] std::string_view name() const;
+
+        [[nodiscard]] std::optional<std::string_view> superClassName() const;
+
+        [[nodiscard]] std::vector<std::string_view> interfaceNames() const;
+
+      protected:
+        [[nodiscard]] static Stream::ReadResult<ClassHeader> tryLoad(std::shared_ptr<const void> storage,
+                                                                     std::span<const u1> bytes,
+                                                                     ConstantPool::Decoding decoding);
+
+        [[nodiscard]] std::string_view className(u2 index) const;
+
+        // ClassInfo parses its header through ClassHeader and takes over the constant pool
+        friend class ClassInfo;
+
+        u2 m_minorVersion;
+        u2 m_majorVersion;
+        ConstantPool m_constantPool;
+        u2 m_accessFlags;
+        u2 m_thisClass;
+        std::optional<u2> m_superClass;
+        std::pmr::vector<u2> m_interfaces;
+    };
+} // namespace AeroJet::Java::ClassFile
@@ -24,13 +24,21 @@
 
 #pragma once
 
+#include "Java/ClassFile/AttributeFilter.hpp"
 #include "Java/ClassFile/Attributes/AttributeInfo.hpp"
 #include "Java/ClassFile/ConstantPool.hpp"
 #include "Java/ClassFile/FieldInfo.hpp"
 #include "Java/ClassFile/MethodInfo.hpp"
+#include "Java/ClassFile/ResolutionCache.hpp"
+#include "Stream/ReadError.hpp"
 #include "Types.hpp"
+#include "Utils/TableView.hpp"
 
+#include <filesystem>
+#include <memory>
+#include <memory_resource>
 #include <optional>
+#include <span>
 #include <vector>
 
 namespace AeroJet::Java::ClassFile
@@ -39,6 +47,7 @@ namespace AeroJet::Java::ClassFile
     {
       public:
         static constexpr u4 JAVA_CLASS_MAGIC = 0xCAFEBABE;
+        static constexpr u2 MAX_JAVA_CLASS_MAJOR_VERSION = 52;
 
         enum class AccessFlags : u2
         {
@@ -54,14 +63,79 @@ namespace AeroJet::Java::ClassFile
 
         ClassInfo(u2 minorVersion,
                   u2 majorVersion,
-                  ConstantPool& constantPool,
+                  ConstantPool constantPool,
                   u2 accessFlags,
                   u2 thisClass,
                   std::optional<u2> superClass,
-                  const std::vector<u2>& interfaces,
-                  const std::vector<FieldInfo>& fields,
-                  const std::vector<MethodInfo>& methods,
-                  const std::vector<AttributeInfo>& attributes);
+                  std::pmr::vector<u2> interfaces,
+                  std::pmr::vector<FieldInfo> fields,
+                  std::pmr::vector<MethodInfo> methods,
+                  std::pmr::vector<AttributeInfo> attributes);
+
+        /**
+         * @brief Maps the class file at given path into memory and parses it in place.
+         * Attribute payloads are borrowed from the mapping rather than copied.
+         * @param path path to the .class file
+         * @return parsed ClassInfo which keeps the mapping alive
+         */
+        [[nodiscard]] static ClassInfo load(const std::filesystem::path& path,
+                                            ConstantPool::Decoding decoding = ConstantPool::Decoding::EAGER,
+                                            std::pmr::memory_resource* memoryResource = std::pmr::get_default_resource(),
+                                            const AttributeFilter& attributeFilter = AttributeFilter::all());
+
+        /**
+         * @brief Parses class file from given bytes, taking ownership of them
+         * @param bytes raw content of the class file
+         * @return parsed ClassInfo which keeps the bytes alive
+         */
+        [[nodiscard]] static ClassInfo load(std::vector<u1> bytes,
+                                            ConstantPool::Decoding decoding = ConstantPool::Decoding::EAGER,
+                                            std::pmr::memory_resource* memoryResource = std::pmr::get_default_resource(),
+                                            const AttributeFilter& attributeFilter = AttributeFilter::all());
+
+        /**
+         * @brief Non-throwing counterpart of load(). Malformed class files are reported as Stream::ReadError.
+         * Failure to open or map the file is still reported by exception.
+         */
+        [[nodiscard]] static Stream::ReadResult<ClassInfo> tryLoad(
+            const std::filesystem::path& path,
+            ConstantPool::Decoding decoding = ConstantPool::Decoding::EAGER,
+            std::pmr::memory_resource* memoryResource = std::pmr::get_default_resource(),
+            const AttributeFilter& attributeFilter = AttributeFilter::all());
+
+        /**
+         * @brief Non-throwing counterpart of load(std::vector<u1>), suitable for bulk scanning of untrusted jars
+         */
+        [[nodiscard]] static Stream::ReadResult<ClassInfo> tryLoad(
+            std::vector<u1> bytes,
+            ConstantPool::Decoding decoding = ConstantPool::Decoding::EAGER,
+            std::pmr::memory_resource* memoryResource = std::pmr::get_default_resource(),
+            const AttributeFilter& attributeFilter = AttributeFilter::all());
+
+        /**
+         * @brief Parses bytes which are kept alive by storage, borrowing attribute payloads from them
+         * @param storage owner of bytes, shared with the returned ClassInfo
+         */
+        [[nodiscard]] static Stream::ReadResult<ClassInfo> tryLoad(std::shared_ptr<const void> storage,
+                                                                   std::span<const u1> bytes,
+                                                                   ConstantPool::Decoding decoding,
+                                                                   std::pmr::memory_resource* memoryResource,
+                                                                   const AttributeFilter& attributeFilter = AttributeFilter::all());
+
+        /**
+         * @brief Parses class file at the cursor, decoding the constant pool as requested.
+         * Stream::Reader::tryRead<ClassInfo> is equivalent to Decoding::EAGER.
+         * @param memoryResource backs the constant pool, the interfaces, fields, methods and attributes tables, the
+         * attributes of every member and owned attribute payloads, so a monotonic arena releases a whole class at once.
+         * It must outlive the ClassInfo; copies of the ClassInfo allocate from the default resource.
+         * @param attributeFilter selects class, field and method attributes to keep, the others are skipped
+         * by their length without being copied. Only used during the call.
+         */
+        [[nodiscard]] static Stream::ReadResult<ClassInfo> tryRead(
+            Stream::ByteCursor& cursor,
+            ConstantPool::Decoding decoding,
+            std::pmr::memory_resource* memoryResource = std::pmr::get_default_resource(),
+            const AttributeFilter& attributeFilter = AttributeFilter::all());
 
         /**
          * The values of the minor_version and major_version items are the minor and major version numbers of this
@@ -87,6 +161,13 @@ namespace AeroJet::Java::ClassFile
          */
         [[nodiscard]] const ConstantPool& constantPool() const;
 
+        /**
+         * Resolves CLASS, NAME_AND_TYPE, FIELD_REF, METHOD_REF or INTERFACE_METHOD_REF entry of the constant pool to
+         * interned names and a parsed descriptor. Each index is resolved once, repeated calls return the same object.
+         * Copies made after the first call share resolved references.
+         */
+        [[nodiscard]] const ResolvedReference& resolve(u2 index) const;
+
         /**
          * The value of the access_flags item is a mask of flags used to denote access permissions to and properties of
          * this class or interface. The interpretation of each flag, when set, is specified in Table 4.1-A.
@@ -174,14 +255,14 @@ namespace AeroJet::Java::ClassFile
          * a CONSTANT_Class_info structure representing an interface that is a direct superinterface of this class
          * or interface type, in the left-to-right order given in the source for the type.
          */
-        [[nodiscard]] const std::vector<u2>& interfaces() const;
+        [[nodiscard]] AeroJet::Utils::TableView<u2> interfaces() const;
 
         /**
          * Each value in the fields table must be a field_info structure (§4.5) giving a complete description of a field
          * in this class or interface. The fields table includes only those fields that are declared by this class or
          * interface. It does not include items representing fields that are inherited from superclasses or superinterfaces.
          */
-        [[nodiscard]] const std::vector<FieldInfo>& fields() const;
+        [[nodiscard]] AeroJet::Utils::TableView<FieldInfo> fields() const;
 
         /**
          * Each value in the methods table must be a method_info structure (§4.6) giving a complete description of a
@@ -194,7 +275,7 @@ namespace AeroJet::Java::ClassFile
          * initialization method (§2.9). The methods table does not include items representing methods that are
          * inherited from superclasses or superinterfaces.
          */
-        [[nodiscard]] const std::vector<MethodInfo>& methods() const;
+        [[nodiscard]] AeroJet::Utils::TableView<MethodInfo> methods() const;
 
         /**
          * Each value of the attributes table must be an attribute_info structure (§4.7).
@@ -207,19 +288,36 @@ namespace AeroJet::Java::ClassFile
          * The rules concerning non-predefined attributes in the attributes table of a ClassFile structure
          * are given in §4.7.1.
          */
-        [[nodiscard]] const std::vector<AttributeInfo>& attributes() const;
+        [[nodiscard]] AeroJet::Utils::TableView<AttributeInfo> attributes() const;
+
+        /**
+         * @brief First attribute of given kind, found in constant time
+         * @return nullptr if there is no such attribute, or it was dropped by an AttributeFilter
+         */
+        [[nodiscard]] const AttributeInfo* findAttribute(AttributeKind kind) const;
+
+        /**
+         * Raw bytes of the class file this ClassInfo was loaded from. The buffer is shared between copies of the
+         * ClassInfo, so views into it stay valid as long as any of them is alive.
+         * Empty if the ClassInfo was not created by load().
+         */
+        [[nodiscard]] std::span<const u1> bytes() const;
 
       protected:
+        std::shared_ptr<const void> m_storage;
+        std::span<const u1> m_bytes;
         u2 m_minorVersion;
         u2 m_majorVersion;
         ConstantPool m_constantPool;
+        LazyResolutionCache m_resolutionCache;
         u2 m_accessFlags;
         u2 m_thisClass;
         std::optional<u2> m_superClass;
-        std::vector<u2> m_interfaces;
-        std::vector<FieldInfo> m_fields;
-        std::vector<MethodInfo> m_methods;
-        std::vector<AttributeInfo> m_attributes;
+        std::pmr::vector<u2> m_interfaces;
+        std::pmr::vector<FieldInfo> m_fields;
+        std::pmr::vector<MethodInfo> m_methods;
+        std::pmr::vector<AttributeInfo> m_attributes;
+        AttributeKindIndex m_attributeIndex;
     };
 } // namespace AeroJet::Java::ClassFile
 
@@ -0,0 +1,192 @@
+/*
+ * ClassInfoParser.hpp
+ *
+ * Copyright © 2024 AeroJet Developers. All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the “Software”), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+ * OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include "Java/ClassFile/AttributeFilter.hpp"
+#include "Java/ClassFile/Attributes/AttributeKind.hpp"
+#include "Java/ClassFile/ClassInfo.hpp"
+#include "Stream/ByteCursor.hpp"
+#include "Stream/ReadError.hpp"
+#include "Types.hpp"
+
+#include <cstddef>
+#include <istream>
+#include <memory_resource>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace AeroJet::Java::ClassFile
+{
+    /**
+     * Resumable class file parser for sources which deliver bytes in chunks and can not seek (pipes, decompression
+     * streams, network).
+     *
+     * Every call to feed() decodes as many complete structures (constant pool entries, fields, methods, attributes)
+     * as the received bytes allow and keeps only the unconsumed tail, so parsing overlaps with I/O and a whole file
+     * never has to be buffered up front. Once the last byte of the class file is consumed the parser completes and
+     * the ClassInfo may be taken. Bytes past the end of the class file are ignored.
+     *
+     * Attributes rejected by the AttributeFilter of the parser are skipped as their bytes arrive, without being
+     * buffered.
+     */
+    class ClassInfoParser
+    {
+      public:
+        enum class State : u1
+        {
+            NEED_MORE_DATA,
+            COMPLETE,
+            FAILED
+        };
+
+        ClassInfoParser() = default;
+
+        /**
+         * @param attributeFilter selects class, field and method attributes to keep, copied into the parser
+         */
+        explicit ClassInfoParser(AttributeFilter attributeFilter);
+
+        // The attribute kind resolver refers to the constant pool of the parser
+        ClassInfoParser(const ClassInfoParser&) = delete;
+        ClassInfoParser& operator=(const ClassInfoParser&) = delete;
+
+        /**
+         * @brief Parses the next chunk of the class file
+         * @return state of the parser after the chunk has been consumed
+         */
+        State feed(std::span<const u1> chunk);
+
+        /**
+         * @brief Signals the end of input. Fails with ReadErrorCode::UNEXPECTED_END if the class is incomplete.
+         */
+        State finish();
+
+        [[nodiscard]] State state() const;
+
+        /**
+         * @brief Reason of the failure, only meaningful in State::FAILED
+         */
+        [[nodiscard]] const Stream::ReadError& error() const;
+
+        /**
+         * @brief Number of bytes consumed from the start of the class file
+         */
+        [[nodiscard]] std::size_t consumed() const;
+
+        /**
+         * @brief Moves the parsed class out of the parser
+         * @throws Exceptions::RuntimeException if the parser is not in State::COMPLETE, or the class was already taken
+         */
+        [[nodiscard]] ClassInfo result();
+
+        /**
+         * @brief Parses class file from the stream without seeking, reading it by chunks of given size
+         * @throws Exceptions::RuntimeException if the class file is malformed, the stream ends prematurely or fails
+         */
+        [[nodiscard]] static ClassInfo parse(std::istream& stream,
+                                             std::size_t chunkSize = DEFAULT_CHUNK_SIZE,
+                                             const AttributeFilter& attributeFilter = AttributeFilter::all());
+
+        static constexpr std::size_t DEFAULT_CHUNK_SIZE = 16 * 1024;
+
+      protected:
+        enum class Stage : u1
+        {
+            HEADER,
+            CONSTANT_POOL,
+            CLASS_HEADER,
+            INTERFACES,
+            FIELDS_COUNT,
+            FIELD_HEADER,
+            FIELD_ATTRIBUTES,
+            METHODS_COUNT,
+            METHOD_HEADER,
+            METHOD_ATTRIBUTES,
+            ATTRIBUTES_COUNT,
+            ATTRIBUTES,
+            DONE
+        };
+
+        struct MemberHeader
+        {
+            u2 accessFlags = 0;
+            u2 nameIndex = 0;
+            u2 descriptorIndex = 0;
+            u2 attributesCount = 0;
+            std::pmr::vector<AttributeInfo> attributes;
+        };
+
+        /**
+         * @brief Decodes a single step of the current stage
+         * @return false if more data is required or parsing has failed
+         */
+        bool step(Stream::ByteCursor& cursor);
+
+        bool readAttributes(Stream::ByteCursor& cursor, std::pmr::vector<AttributeInfo>& attributes, std::size_t count);
+
+        bool fail(Stream::ReadErrorCode code, std::size_t offset);
+
+      protected:
+        State m_state = State::NEED_MORE_DATA;
+        Stage m_stage = Stage::HEADER;
+        Stream::ReadError m_error{ Stream::ReadErrorCode::UNEXPECTED_END, 0 };
+
+        // Bytes of incomplete structures, the ones before m_pendingBegin are already consumed
+        std::vector<u1> m_pending;
+        std::size_t m_pendingBegin = 0;
+
+        // Bytes consumed from the start of the class file
+        std::size_t m_pendingOffset = 0;
+        bool m_resultTaken = false;
+
+        u2 m_minorVersion = 0;
+        u2 m_majorVersion = 0;
+        u2 m_constantPoolSize = 0;
+        u2 m_constantPoolIndex = 1;
+        AttributeFilter m_attributeFilter;
+        ConstantPool m_constantPool;
+
+        // Created once the constant pool is complete, classifies every attribute of the class
+        std::optional<AttributeKindResolver> m_attributeKinds;
+        u2 m_accessFlags = 0;
+        u2 m_thisClass = 0;
+        u2 m_superClass = 0;
+        u2 m_interfacesCount = 0;
+        std::pmr::vector<u2> m_interfaces;
+        u2 m_membersCount = 0;
+        MemberHeader m_member;
+        std::pmr::vector<FieldInfo> m_fields;
+        std::pmr::vector<MethodInfo> m_methods;
+        u2 m_attributesCount = 0;
+        std::pmr::vector<AttributeInfo> m_attributes;
+
+        // Attributes of the current table read so far, kept or not
+        u2 m_attributesRead = 0;
+
+        // Bytes of a rejected attribute which are still to be skipped
+        u4 m_attributeSkip = 0;
+    };
+} // namespace AeroJet::Java::ClassFile
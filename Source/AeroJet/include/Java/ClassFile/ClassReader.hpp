@@ -0,0 +1,82 @@
+/*
+ * ClassReader.hpp
+ *
+ * Copyright © 2024 AeroJet Developers. All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the “Software”), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+ * OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include "Java/ClassFile/Attributes/AttributeKind.hpp"
+#include "Java/ClassFile/ClassVisitor.hpp"
+#include "Java/ClassFile/ConstantPool.hpp"
+#include "Stream/ByteBuffer.hpp"
+#include "Stream/ByteCursor.hpp"
+#include "Stream/ReadError.hpp"
+#include "Types.hpp"
+
+#include <memory>
+#include <optional>
+#include <span>
+
+namespace AeroJet::Java::ClassFile
+{
+    /**
+     * Streams a class file to a ClassVisitor. Apart from the constant pool, which is decoded lazily when the bytes
+     * are owned, and the attribute kinds resolved per constant pool slot, memory used per class does not depend on
+     * the size of the class.
+     */
+    class ClassReader
+    {
+      public:
+        /**
+         * @param bytes content of the class file, must stay valid during accept()
+         * @param owner optional owner of bytes, shared with the constant pool and with every reported AttributeInfo
+         */
+        explicit ClassReader(std::span<const u1> bytes, std::shared_ptr<const void> owner = nullptr);
+
+        /**
+         * @brief Reports the class to visitor
+         * @return error of the first malformed structure, events reported before it are not revoked
+         */
+        [[nodiscard]] std::optional<Stream::ReadError> accept(ClassVisitor& visitor) const;
+
+      protected:
+        [[nodiscard]] std::optional<Stream::ReadError> readField(Stream::ByteCursor& cursor,
+                                                                 AttributeKindResolver& attributeKinds,
+                                                                 ClassVisitor& visitor) const;
+
+        /**
+         * @param operands scratch buffer of instruction decoding, shared by all methods of the class
+         */
+        [[nodiscard]] std::optional<Stream::ReadError> readMethod(Stream::ByteCursor& cursor,
+                                                                  AttributeKindResolver& attributeKinds,
+                                                                  Stream::ByteBuffer& operands,
+                                                                  ClassVisitor& visitor) const;
+
+        [[nodiscard]] std::optional<Stream::ReadError> readCode(const AttributeInfo& code,
+                                                                AttributeKindResolver& attributeKinds,
+                                                                Stream::ByteBuffer& operands,
+                                                                MethodVisitor& visitor) const;
+
+        std::span<const u1> m_bytes;
+        std::shared_ptr<const void> m_owner;
+    };
+} // namespace AeroJet::Java::ClassFile
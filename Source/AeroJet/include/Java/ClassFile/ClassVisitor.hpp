@@ -0,0 +1,126 @@
+/*
+ * ClassVisitor.hpp
+ *
+ * Copyright © 2024 AeroJet Developers. All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the “Software”), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+ * OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include "Java/ByteCode/Instruction.hpp"
+#include "Java/ClassFile/Attributes/AttributeInfo.hpp"
+#include "Java/ClassFile/ClassHeader.hpp"
+#include "Types.hpp"
+
+#include <string_view>
+
+namespace AeroJet::Java::ClassFile
+{
+    /**
+     * Receives attributes of a field. AttributeInfo payloads borrow from the class bytes and stay valid after the
+     * callback only if AttributeInfo::storage() is set.
+     */
+    class FieldVisitor
+    {
+      public:
+        virtual ~FieldVisitor() = default;
+
+        virtual void visitAttribute(std::string_view /*name*/, const AttributeInfo& /*attribute*/) {}
+
+        virtual void visitEnd() {}
+    };
+
+    /**
+     * Receives attributes and code of a method in file order.
+     */
+    class MethodVisitor
+    {
+      public:
+        virtual ~MethodVisitor() = default;
+
+        /**
+         * @brief Called for every attribute of the method except Code
+         */
+        virtual void visitAttribute(std::string_view /*name*/, const AttributeInfo& /*attribute*/) {}
+
+        /**
+         * @brief Called when the Code attribute is reached
+         * @return false to skip the instructions, exception table and attributes of the code by their length prefix
+         */
+        virtual bool visitCode(u2 /*maxStack*/, u2 /*maxLocals*/, u4 /*codeLength*/)
+        {
+            return true;
+        }
+
+        /**
+         * @param offset offset of the instruction from the beginning of the code
+         */
+        virtual void visitInstruction(u4 /*offset*/, const ByteCode::Instruction& /*instruction*/) {}
+
+        virtual void visitExceptionHandler(u2 /*startPc*/, u2 /*endPc*/, u2 /*handlerPc*/, u2 /*catchType*/) {}
+
+        /**
+         * @brief Called for attributes of the Code attribute (LineNumberTable, LocalVariableTable, StackMapTable...)
+         */
+        virtual void visitCodeAttribute(std::string_view /*name*/, const AttributeInfo& /*attribute*/) {}
+
+        virtual void visitEnd() {}
+    };
+
+    /**
+     * Event-driven counterpart of ClassInfo: ClassReader reports parts of the class file to a visitor in file order
+     * without building a tree. Skipping a field or a method costs a walk over the length prefixes of its attributes.
+     *
+     * Names and descriptors of members and attributes are views of the raw modified UTF-8 bytes of the constant pool,
+     * they differ from standard UTF-8 only for NUL and supplementary characters and may be converted with
+     * Utils::ModifiedUtf8Utils::toUtf8(). Reported attributes carry their AttributeKind, so standard attributes are
+     * better told apart by AttributeInfo::kind() than by name.
+     */
+    class ClassVisitor
+    {
+      public:
+        virtual ~ClassVisitor() = default;
+
+        /**
+         * @brief Called first, the constant pool of the header is used to resolve names of all following events
+         */
+        virtual void visitHeader(const ClassHeader& /*header*/) {}
+
+        /**
+         * @return visitor for the attributes of the field, nullptr to skip them
+         */
+        virtual FieldVisitor* visitField(u2 /*accessFlags*/, std::string_view /*name*/, std::string_view /*descriptor*/)
+        {
+            return nullptr;
+        }
+
+        /**
+         * @return visitor for the attributes and code of the method, nullptr to skip them
+         */
+        virtual MethodVisitor* visitMethod(u2 /*accessFlags*/, std::string_view /*name*/, std::string_view /*descriptor*/)
+        {
+            return nullptr;
+        }
+
+        virtual void visitAttribute(std::string_view /*name*/, const AttributeInfo& /*attribute*/) {}
+
+        virtual void visitEnd() {}
+    };
+} // namespace AeroJet::Java::ClassFile
@@ -25,21 +25,176 @@
 #pragma once
 
 #include "ConstantPoolEntry.hpp"
+#include "Stream/ByteCursor.hpp"
+#include "Stream/ReadError.hpp"
 #include "Types.hpp"
 
-#include <map>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
 
 namespace AeroJet::Java::ClassFile
 {
-    using ConstantPoolBaseType = std::map<u2, ConstantPoolEntry>;
-
-    class ConstantPool final : ConstantPoolBaseType
+    /**
+     * Constant pool stored as a contiguous array indexed by the slot number, so that resolving an index is a single
+     * bounds-checked load. Index 0 and the slot following every LONG and DOUBLE entry are unusable and hold an empty
+     * sentinel: at() rejects them and iteration skips them, the same way as for absent keys of an ordered map.
+     */
+    class ConstantPool final
     {
       public:
-        using ConstantPoolBaseType::at;
-        using ConstantPoolBaseType::begin;
-        using ConstantPoolBaseType::end;
-        using ConstantPoolBaseType::insert;
-        using ConstantPoolBaseType::size;
+        enum class Decoding : u1
+        {
+            /**
+             * Every entry is decoded while the pool is read
+             */
+            EAGER,
+
+            /**
+             * Only tags and offsets of entries are recorded while the pool is read. An entry is decoded the first
+             * time it is accessed and memoized, so scans which touch a few entries do not pay for the whole pool.
+             * Requires the class bytes to be owned (ByteCursor::owner()), otherwise the pool is decoded eagerly.
+             */
+            LAZY,
+
+            /**
+             * Offsets of entries are found by a sequential scan of tags and lengths, after which the entries are
+             * decoded by several threads in chunks. Meant for latency of single huge pools (generated or obfuscated
+             * code); small pools are decoded on the calling thread.
+             */
+            PARALLEL
+        };
+
+        using value_type = std::pair<u2, const ConstantPoolEntry&>;
+
+        class const_iterator
+        {
+          public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = ConstantPool::value_type;
+            using difference_type = std::ptrdiff_t;
+            using reference = value_type;
+            using pointer = void;
+
+            const_iterator() = default;
+
+            [[nodiscard]] reference operator*() const
+            {
+                return { static_cast<u2>(m_index), m_constantPool->at(static_cast<u2>(m_index)) };
+            }
+
+            const_iterator& operator++()
+            {
+                m_index = m_constantPool->nextUsable(m_index + 1);
+                return *this;
+            }
+
+            const_iterator operator++(int)
+            {
+                const_iterator previous = *this;
+                ++(*this);
+                return previous;
+            }
+
+            [[nodiscard]] bool operator==(const const_iterator& other) const
+            {
+                return m_index == other.m_index;
+            }
+
+          private:
+            friend class ConstantPool;
+
+            const_iterator(const ConstantPool* constantPool, std::size_t index) :
+                m_constantPool(constantPool), m_index(index) {}
+
+            const ConstantPool* m_constantPool = nullptr;
+            std::size_t m_index = 0;
+        };
+
+        using iterator = const_iterator;
+
+        ConstantPool() = default;
+
+        /**
+         * @param memoryResource backs the slot array. Copies of the pool allocate from the default resource.
+         */
+        explicit ConstantPool(std::pmr::memory_resource* memoryResource);
+
+        /**
+         * @brief Reads constantPoolCount - 1 entries (constant_pool_count item of the class file) from the cursor
+         * @param memoryResource backs the slot array of an eagerly or parallel decoded pool
+         */
+        [[nodiscard]] static Stream::ReadResult<ConstantPool> tryRead(
+            Stream::ByteCursor& cursor,
+            u2 constantPoolCount,
+            Decoding decoding = Decoding::EAGER,
+            std::pmr::memory_resource* memoryResource = std::pmr::get_default_resource());
+
+        /**
+         * @brief Preallocates slots for constant_pool_count entries (including the unusable index 0)
+         */
+        void reserve(u2 constantPoolCount);
+
+        /**
+         * @brief Places entry into the slot of given index, replacing the previous one
+         */
+        void insert(std::pair<u2, ConstantPoolEntry>&& indexedEntry);
+
+        /**
+         * @throws std::out_of_range if index does not refer to a usable slot
+         * @throws Exceptions::RuntimeException if a lazily decoded entry turns out to be malformed
+         */
+        [[nodiscard]] const ConstantPoolEntry& at(u2 index) const;
+
+        [[nodiscard]] bool contains(u2 index) const;
+
+        /**
+         * @brief Symbol id of the UTF-8 entry at given index, comparable across constant pools
+         * @throws std::out_of_range if index does not refer to a usable slot
+         */
+        [[nodiscard]] SymbolId symbol(u2 index) const;
+
+        /**
+         * @brief Number of usable entries
+         */
+        [[nodiscard]] std::size_t size() const;
+
+        /**
+         * @brief Number of slots including index 0 and the unusable slots following LONG and DOUBLE entries
+         */
+        [[nodiscard]] std::size_t slotCount() const;
+
+        [[nodiscard]] bool isLazy() const;
+
+        [[nodiscard]] const_iterator begin() const;
+
+        [[nodiscard]] const_iterator end() const;
+
+      private:
+        struct LazyEntries;
+
+        /**
+         * @brief Decodes entries at given offsets into slots using several threads
+         * @return the first malformed entry, if any
+         */
+        std::optional<Stream::ReadError> decodeParallel(std::span<const u1> bytes, const std::vector<u4>& offsets);
+
+        /**
+         * @brief Decodes all lazily recorded entries into slots, so that the pool can be modified
+         */
+        void materialize();
+
+        [[nodiscard]] std::size_t nextUsable(std::size_t index) const;
+
+        std::pmr::vector<std::optional<ConstantPoolEntry>> m_slots;
+        std::size_t m_size = 0;
+
+        // Shared between copies of the pool, entries decoded through any copy are memoized for all of them
+        std::shared_ptr<LazyEntries> m_lazyEntries;
     };
 } // namespace AeroJet::Java::ClassFile
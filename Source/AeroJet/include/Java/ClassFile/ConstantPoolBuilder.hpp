@@ -0,0 +1,124 @@
+/*
+ * ConstantPoolBuilder.hpp
+ *
+ * Copyright © 2024 AeroJet Developers. All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the “Software”), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+ * OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include "Java/ClassFile/ConstantPool.hpp"
+#include "Java/ClassFile/ConstantPoolEntry.hpp"
+#include "Stream/ByteBuffer.hpp"
+#include "Types.hpp"
+
+#include <optional>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace AeroJet::Java::ClassFile
+{
+    /**
+     * Builds a constant pool for class file emission.
+     *
+     * Entries are hash-consed on their tag and payload, so adding an entry which is already in the pool returns the
+     * existing index in O(1) instead of growing the pool. LONG and DOUBLE entries take two slots, as required by §4.4.5.
+     */
+    class ConstantPoolBuilder
+    {
+      public:
+        ConstantPoolBuilder();
+
+        /**
+         * @brief Starts from an existing pool, keeping all of its indices valid
+         */
+        explicit ConstantPoolBuilder(const ConstantPool& constantPool);
+
+        /**
+         * @brief Adds entry unless an equal one is present
+         * @return index of the entry
+         * @throws Exceptions::RuntimeException if the pool is full
+         */
+        u2 add(const ConstantPoolEntry& entry);
+
+        /**
+         * @param string modified UTF-8 bytes of the string
+         */
+        u2 utf8(std::string_view string);
+
+        u2 classInfo(std::string_view name);
+
+        u2 string(std::string_view value);
+
+        u2 nameAndType(std::string_view name, std::string_view descriptor);
+
+        /**
+         * @param tag FIELD_REF, METHOD_REF or INTERFACE_METHOD_REF
+         */
+        u2 memberRef(ConstantPoolInfoTag tag, std::string_view className, std::string_view name, std::string_view descriptor);
+
+        [[nodiscard]] std::optional<u2> find(const ConstantPoolEntry& entry) const;
+
+        /**
+         * @throws std::out_of_range if index does not refer to an entry
+         */
+        [[nodiscard]] const ConstantPoolEntry& at(u2 index) const;
+
+        /**
+         * @brief Number of times add() returned index, including adds of nested entries made by the helpers above
+         */
+        [[nodiscard]] u4 useCount(u2 index) const;
+
+        /**
+         * @brief Value of constant_pool_count, one more than the largest index
+         */
+        [[nodiscard]] u2 count() const;
+
+        /**
+         * @brief Reorders entries by descending use count. Constants loadable by ldc come first, so that the most
+         * used of them get indices addressable by ldc however many UTF-8 and reference entries the pool has. LONG and
+         * DOUBLE entries, which are loaded by ldc2_w, are placed after all others. References between entries are
+         * rewritten.
+         * @return table mapping every old index to the new one, for rewriting references held outside of the pool
+         */
+        std::vector<u2> orderByFrequency();
+
+        [[nodiscard]] ConstantPool build() const;
+
+        /**
+         * @brief Writes constant_pool_count followed by the constant_pool table
+         */
+        void writeTo(Stream::ByteBuffer& buffer) const;
+
+      protected:
+        struct KeyHash
+        {
+            std::size_t operator()(const std::pair<ConstantPoolInfoTag, u8>& key) const;
+        };
+
+        u2 append(const ConstantPoolEntry& entry);
+
+        std::vector<std::optional<ConstantPoolEntry>> m_slots;
+        std::vector<u4> m_useCounts;
+        std::unordered_map<std::pair<ConstantPoolInfoTag, u8>, u2, KeyHash> m_indices;
+    };
+} // namespace AeroJet::Java::ClassFile
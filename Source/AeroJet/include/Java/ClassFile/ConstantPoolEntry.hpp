@@ -24,10 +24,13 @@
 
 #pragma once
 
+#include "Java/ClassFile/SymbolTable.hpp"
 #include "Stream/StreamUtils.hpp"
 #include "Types.hpp"
 
+#include <span>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -54,16 +57,48 @@ namespace AeroJet::Java::ClassFile
     class ConstantPoolInfoUtf8
     {
       public:
-        explicit ConstantPoolInfoUtf8(const std::vector<u1>& bytes);
+        ConstantPoolInfoUtf8(std::span<const u1> bytes, SymbolId symbol);
 
         [[nodiscard]] u2 length() const;
 
+        /**
+         * @brief Id of the string in SymbolTable::global()
+         */
+        [[nodiscard]] SymbolId symbol() const;
+
+        /**
+         * @brief Raw modified UTF-8 bytes of the string
+         */
         [[nodiscard]] std::vector<u1> bytes() const;
 
+        /**
+         * @brief View of the raw modified UTF-8 bytes, owned by SymbolTable::global()
+         */
+        [[nodiscard]] std::span<const u1> rawBytes() const;
+
+        /**
+         * @brief Raw modified UTF-8 bytes as a string, owned by SymbolTable::global()
+         * Equal to the standard UTF-8 form unless the string contains U+0000 or supplementary characters.
+         */
+        [[nodiscard]] std::string_view rawString() const;
+
+        /**
+         * @brief String converted to standard UTF-8
+         */
         [[nodiscard]] std::string asString() const;
 
+        /**
+         * @brief String converted to standard UTF-8 without allocation when no conversion is needed
+         * @param storage buffer for the converted string, used only if the raw bytes are not plain ASCII
+         * @return view of the interned bytes or of storage
+         */
+        [[nodiscard]] std::string_view asStringView(std::string& storage) const;
+
+        [[nodiscard]] std::u16string asUtf16() const;
+
       private:
-        std::string m_string;
+        std::span<const u1> m_bytes;
+        SymbolId m_symbol;
     };
 
     class ConstantPoolInfoInteger
@@ -200,14 +235,46 @@ namespace AeroJet::Java::ClassFile
         u2 m_nameAndTypeIndex;
     };
 
+    /**
+     * Constant pool entry decoded once into a fixed-size tagged union, so that as<T>() is a plain field load.
+     * UTF-8 entries are interned into SymbolTable::global() and reference the interned bytes.
+     */
     class ConstantPoolEntry
     {
       public:
-        ConstantPoolEntry(ConstantPoolInfoTag tag, const std::vector<u1>& data);
+        [[nodiscard]] static ConstantPoolEntry utf8(std::span<const u1> bytes);
+
+        /**
+         * @brief Entry of INTEGER or FLOAT tag
+         */
+        [[nodiscard]] static ConstantPoolEntry value(ConstantPoolInfoTag tag, u4 bytes);
+
+        /**
+         * @brief Entry of LONG or DOUBLE tag
+         */
+        [[nodiscard]] static ConstantPoolEntry wideValue(ConstantPoolInfoTag tag, u4 highBytes, u4 lowBytes);
+
+        /**
+         * @brief Entry made of one or two constant pool indices (CLASS, STRING, METHOD_TYPE, references,
+         * NAME_AND_TYPE and INVOKE_DYNAMIC)
+         */
+        [[nodiscard]] static ConstantPoolEntry indices(ConstantPoolInfoTag tag, u2 firstIndex, u2 secondIndex = 0);
+
+        [[nodiscard]] static ConstantPoolEntry methodHandle(ConstantPoolInfoMethodHandle::ReferenceKind referenceKind,
+                                                            u2 referenceIndex);
 
         [[nodiscard]] ConstantPoolInfoTag tag() const;
 
-        [[nodiscard]] const std::vector<u1>& data() const;
+        /**
+         * @brief Payload bits which together with the tag identify the content of the entry.
+         * UTF_8 entries are keyed by their interned symbol, so equal strings have equal keys.
+         */
+        [[nodiscard]] u8 contentKey() const;
+
+        /**
+         * @brief Size of the data following the tag byte. 0 for UTF_8, which is variable-sized, and for unknown tags.
+         */
+        [[nodiscard]] static std::size_t dataSize(ConstantPoolInfoTag tag);
 
         /*
          * FIXME: this is kinda unsafe because of no m_tag validation inside specialized realizations
@@ -217,7 +284,30 @@ namespace AeroJet::Java::ClassFile
         T as() const;
 
       protected:
+        explicit ConstantPoolEntry(ConstantPoolInfoTag tag);
+
         ConstantPoolInfoTag m_tag;
-        std::vector<u1> m_data;
+        u2 m_utf8Length = 0;
+        SymbolId m_symbol = 0;
+
+        union
+        {
+            const u1* utf8;
+            u4 value;
+
+            struct
+            {
+                u4 high;
+                u4 low;
+            } wide;
+
+            struct
+            {
+                u2 first;
+                u2 second;
+            } indices;
+        } m_payload{};
     };
+
+    static_assert(sizeof(ConstantPoolEntry) <= 16, "ConstantPoolEntry is expected to stay compact");
 } // namespace AeroJet::Java::ClassFile
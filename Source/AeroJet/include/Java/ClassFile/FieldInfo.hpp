@@ -24,9 +24,15 @@
 
 #pragma once
 
+#include "Java/ClassFile/AttributeFilter.hpp"
 #include "Java/ClassFile/Attributes/AttributeInfo.hpp"
+#include "Java/ClassFile/ConstantPool.hpp"
+#include "Stream/ByteCursor.hpp"
+#include "Stream/ReadError.hpp"
 #include "Types.hpp"
+#include "Utils/TableView.hpp"
 
+#include <memory_resource>
 #include <vector>
 
 namespace AeroJet::Java::ClassFile
@@ -47,7 +53,22 @@ namespace AeroJet::Java::ClassFile
             ACC_ENUM = 0x4000
         };
 
-        FieldInfo(u2 accessFlags, u2 nameIndex, u2 descriptorIndex, const std::vector<AttributeInfo>& attributes);
+        FieldInfo(u2 accessFlags, u2 nameIndex, u2 descriptorIndex, std::pmr::vector<AttributeInfo> attributes);
+
+        /**
+         * @brief Parses field_info at the cursor
+         */
+        [[nodiscard]] static Stream::ReadResult<FieldInfo> tryRead(Stream::ByteCursor& cursor);
+
+        /**
+         * @brief Parses field_info at the cursor, skipping attributes rejected by attributeFilter without copying them
+         * @param resolver resolves names and kinds of the attributes
+         * @param memoryResource backs the attributes table and owned attribute payloads
+         */
+        [[nodiscard]] static Stream::ReadResult<FieldInfo> tryRead(Stream::ByteCursor& cursor,
+                                                                   AttributeKindResolver& resolver,
+                                                                   const AttributeFilter& attributeFilter,
+                                                                   std::pmr::memory_resource* memoryResource = std::pmr::get_default_resource());
 
         /**
          * The value of the access_flags item is a mask of flags used to denote access permission to and properties of
@@ -109,13 +130,25 @@ namespace AeroJet::Java::ClassFile
          *
          * The rules concerning non-predefined attributes in the attributes table of a field_info structure are given in §4.7.1.
          */
-        [[nodiscard]] const std::vector<AttributeInfo>& attributes() const;
+        [[nodiscard]] AeroJet::Utils::TableView<AttributeInfo> attributes() const;
+
+        /**
+         * @brief First attribute of given kind, found in constant time
+         * @return nullptr if there is no such attribute, or it was dropped by an AttributeFilter
+         */
+        [[nodiscard]] const AttributeInfo* findAttribute(AttributeKind kind) const;
 
       protected:
+        [[nodiscard]] static Stream::ReadResult<FieldInfo> tryRead(Stream::ByteCursor& cursor,
+                                                                   AttributeKindResolver* resolver,
+                                                                   const AttributeFilter& attributeFilter,
+                                                                   std::pmr::memory_resource* memoryResource);
+
         u2 m_accessFlags;
         u2 m_nameIndex;
         u2 m_descriptorIndex;
-        std::vector<AttributeInfo> m_attributes;
+        std::pmr::vector<AttributeInfo> m_attributes;
+        AttributeKindIndex m_attributeIndex;
     };
 } // namespace AeroJet::Java::ClassFile
 
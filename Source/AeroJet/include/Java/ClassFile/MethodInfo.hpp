@@ -24,13 +24,24 @@
 
 #pragma once
 
+#include "Java/ClassFile/AttributeFilter.hpp"
 #include "Java/ClassFile/Attributes/AttributeInfo.hpp"
+#include "Java/ClassFile/ConstantPool.hpp"
+#include "Stream/ByteCursor.hpp"
+#include "Stream/ReadError.hpp"
 #include "Types.hpp"
+#include "Utils/TableView.hpp"
 
+#include <atomic>
+#include <memory_resource>
 #include <vector>
 
 namespace AeroJet::Java::ClassFile
 {
+    class Code;
+    class LineNumberTable;
+    class StackMapTable;
+
     /*
      * 4.6 Methods
      *
@@ -83,7 +94,37 @@ namespace AeroJet::Java::ClassFile
             ACC_SYNTHETIC = 0x1000
         };
 
-        MethodInfo(u2 accessFlags, u2 nameIndex, u2 descriptorIndex, const std::vector<AttributeInfo>& attributes);
+        MethodInfo(u2 accessFlags, u2 nameIndex, u2 descriptorIndex, std::pmr::vector<AttributeInfo> attributes);
+
+        /**
+         * Copies do not share decoded attributes with the original, they decode their own on first use.
+         */
+        MethodInfo(const MethodInfo& other);
+
+        /**
+         * Decoded attributes are transferred, the moved-from method decodes again if it is still used.
+         */
+        MethodInfo(MethodInfo&& other) noexcept;
+
+        MethodInfo& operator=(const MethodInfo& other);
+        MethodInfo& operator=(MethodInfo&& other) noexcept;
+
+        ~MethodInfo();
+
+        /**
+         * @brief Parses method_info at the cursor
+         */
+        [[nodiscard]] static Stream::ReadResult<MethodInfo> tryRead(Stream::ByteCursor& cursor);
+
+        /**
+         * @brief Parses method_info at the cursor, skipping attributes rejected by attributeFilter without copying them
+         * @param resolver resolves names and kinds of the attributes
+         * @param memoryResource backs the attributes table and owned attribute payloads
+         */
+        [[nodiscard]] static Stream::ReadResult<MethodInfo> tryRead(Stream::ByteCursor& cursor,
+                                                                    AttributeKindResolver& resolver,
+                                                                    const AttributeFilter& attributeFilter,
+                                                                    std::pmr::memory_resource* memoryResource = std::pmr::get_default_resource());
 
         [[nodiscard]] AccessFlags accessFlags() const;
 
@@ -91,12 +132,55 @@ namespace AeroJet::Java::ClassFile
 
         [[nodiscard]] u2 descriptorIndex() const;
 
-        [[nodiscard]] const std::vector<AttributeInfo>& attributes() const;
+        [[nodiscard]] AeroJet::Utils::TableView<AttributeInfo> attributes() const;
+
+        /**
+         * @brief First attribute of given kind, found in constant time
+         * @return nullptr if there is no such attribute, or it was dropped by an AttributeFilter
+         */
+        [[nodiscard]] const AttributeInfo* findAttribute(AttributeKind kind) const;
+
+        /**
+         * @brief Code attribute of the method, decoded on first use and kept for later calls. Thread-safe.
+         * @param constantPool constant pool of the class the method was read from. Only the first call reads it, later
+         * calls return the cached attribute whatever pool they pass.
+         * @return nullptr for abstract and native methods, or if Code was dropped by an AttributeFilter
+         * @throws Exceptions::RuntimeException if the Code attribute is malformed, decoding is retried on next call
+         */
+        [[nodiscard]] const Code* code(const ConstantPool& constantPool) const;
+
+        /**
+         * @brief StackMapTable attribute of the code, decoded on first use like code()
+         * @return nullptr if the method has no code or the code has no StackMapTable
+         */
+        [[nodiscard]] const StackMapTable* stackMapTable(const ConstantPool& constantPool) const;
+
+        /**
+         * @brief LineNumberTable attribute of the code, decoded on first use like code()
+         * @return nullptr if the method has no code or the code has no LineNumberTable
+         */
+        [[nodiscard]] const LineNumberTable* lineNumberTable(const ConstantPool& constantPool) const;
 
       protected:
+        struct DecodedAttributes;
+
+        /**
+         * @brief Allocates the decoded attributes on first use, so that methods which are never analyzed do not pay for them
+         */
+        [[nodiscard]] DecodedAttributes& decodedAttributes() const;
+
+        [[nodiscard]] static Stream::ReadResult<MethodInfo> tryRead(Stream::ByteCursor& cursor,
+                                                                    AttributeKindResolver* resolver,
+                                                                    const AttributeFilter& attributeFilter,
+                                                                    std::pmr::memory_resource* memoryResource);
+
         u2 m_accessFlags;
         u2 m_nameIndex;
         u2 m_descriptorIndex;
-        std::vector<AttributeInfo> m_attributes;
+        std::pmr::vector<AttributeInfo> m_attributes;
+        AttributeKindIndex m_attributeIndex;
+
+        // Owned, nullptr until the first decoding
+        mutable std::atomic<DecodedAttributes*> m_decodedAttributes;
     };
 } // namespace AeroJet::Java::ClassFile
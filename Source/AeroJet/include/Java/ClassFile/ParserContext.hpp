@@ -0,0 +1,113 @@
+/*
+ * ParserContext.hpp
+ *
+ * Copyright © 2024 AeroJet Developers. All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the “Software”), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+ * OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include "Java/ClassFile/AttributeFilter.hpp"
+#include "Java/ClassFile/ClassInfo.hpp"
+#include "Java/ClassFile/ConstantPool.hpp"
+#include "Stream/ReadError.hpp"
+#include "Types.hpp"
+
+#include <istream>
+#include <memory>
+#include <memory_resource>
+#include <span>
+#include <vector>
+
+namespace AeroJet::Java::ClassFile
+{
+    /**
+     * Scratch state reused across consecutive class parses on one thread.
+     *
+     * Parsed classes allocate their constant pool, their member and attribute tables and the scratch tables of the
+     * parse from a pool owned by the context, so memory released by a destroyed ClassInfo is handed to the next parse
+     * instead of going back to the global allocator. The class bytes are read into a buffer which is recycled as soon
+     * as no ClassInfo parsed from it is alive. Once warmed up, parsing a stream of similar classes does not reach the
+     * upstream allocator.
+     *
+     * Parsing is not thread-safe, but parsed classes may be handed over to other threads: the pool is synchronized,
+     * and each parsed ClassInfo keeps it alive, so classes may outlive the context (e.g. the one of an exited thread).
+     */
+    class ParserContext
+    {
+      public:
+        explicit ParserContext(std::pmr::memory_resource* upstream = std::pmr::get_default_resource());
+
+        ParserContext(const ParserContext&) = delete;
+        ParserContext& operator=(const ParserContext&) = delete;
+
+        /**
+         * @brief Context of the calling thread
+         */
+        [[nodiscard]] static ParserContext& local();
+
+        /**
+         * @brief Buffer to fill with the bytes of the next class, e.g. by Jar::Entry::readInto
+         */
+        [[nodiscard]] std::vector<u1>& buffer();
+
+        /**
+         * @brief Parses the content of buffer()
+         */
+        [[nodiscard]] Stream::ReadResult<ClassInfo> tryParse(ConstantPool::Decoding decoding = ConstantPool::Decoding::EAGER);
+
+        /**
+         * @brief Copies bytes into buffer() and parses them
+         */
+        [[nodiscard]] Stream::ReadResult<ClassInfo> tryParse(std::span<const u1> bytes,
+                                                             ConstantPool::Decoding decoding = ConstantPool::Decoding::EAGER);
+
+        /**
+         * @brief Reads the rest of the stream into buffer() and parses it
+         */
+        [[nodiscard]] Stream::ReadResult<ClassInfo> tryParse(std::istream& stream,
+                                                             ConstantPool::Decoding decoding = ConstantPool::Decoding::EAGER);
+
+        [[nodiscard]] ClassInfo parse(ConstantPool::Decoding decoding = ConstantPool::Decoding::EAGER);
+
+        [[nodiscard]] std::pmr::memory_resource* memoryResource();
+
+        /**
+         * @brief Restricts attributes materialized by the following parses, every attribute is kept by default
+         */
+        void setAttributeFilter(AttributeFilter attributeFilter);
+
+        [[nodiscard]] const AttributeFilter& attributeFilter() const;
+
+      protected:
+        /**
+         * Shared by parsed classes as their storage, which ties the lifetime of the pool to the last of them
+         */
+        struct Buffer
+        {
+            std::vector<u1> bytes;
+            std::shared_ptr<std::pmr::synchronized_pool_resource> pool;
+        };
+
+        std::shared_ptr<std::pmr::synchronized_pool_resource> m_pool;
+        std::shared_ptr<Buffer> m_buffer;
+        AttributeFilter m_attributeFilter;
+    };
+} // namespace AeroJet::Java::ClassFile
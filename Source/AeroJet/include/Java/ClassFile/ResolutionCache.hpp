@@ -0,0 +1,125 @@
+/*
+ * ResolutionCache.hpp
+ *
+ * Copyright © 2024 AeroJet Developers. All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the “Software”), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+ * OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include "Java/ClassFile/ConstantPool.hpp"
+#include "Java/ClassFile/FieldDescriptor.hpp"
+#include "Java/ClassFile/MethodDescriptor.hpp"
+#include "Java/ClassFile/SymbolTable.hpp"
+#include "Types.hpp"
+
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <variant>
+
+namespace AeroJet::Java::ClassFile
+{
+    /**
+     * Symbolic reference of the constant pool resolved to interned names.
+     * Fields which are not meaningful for the tag of the reference are left empty.
+     */
+    struct ResolvedReference
+    {
+        ConstantPoolInfoTag tag{};
+
+        /**
+         * Class name for CLASS and for FIELD_REF, METHOD_REF and INTERFACE_METHOD_REF (owner class of the member)
+         */
+        Symbol className{};
+
+        /**
+         * Member name for NAME_AND_TYPE, FIELD_REF, METHOD_REF and INTERFACE_METHOD_REF
+         */
+        Symbol name{};
+
+        Symbol descriptor{};
+
+        /**
+         * FieldDescriptor or MethodDescriptor parsed from the descriptor, std::monostate for CLASS
+         */
+        std::variant<std::monostate, FieldDescriptor, MethodDescriptor> parsedDescriptor{};
+    };
+
+    /**
+     * Memoizes resolution of CLASS, NAME_AND_TYPE, FIELD_REF, METHOD_REF and INTERFACE_METHOD_REF entries of a
+     * single constant pool, so that every index is resolved once no matter how many times analyses hit it.
+     * Safe to use from multiple threads: lookups of resolved indices are a single atomic load.
+     */
+    class ResolutionCache
+    {
+      public:
+        explicit ResolutionCache(std::size_t slotCount);
+
+        /**
+         * @param constantPool pool the cache was created for
+         * @throws std::out_of_range if index does not refer to a usable slot
+         * @throws Exceptions::RuntimeException if entry at index is not a symbolic reference, or an entry it refers to
+         * has an unexpected tag
+         */
+        [[nodiscard]] const ResolvedReference& resolve(const ConstantPool& constantPool, u2 index);
+
+      protected:
+        [[nodiscard]] ResolvedReference resolveUncached(const ConstantPool& constantPool, u2 index);
+
+        /**
+         * @throws Exceptions::RuntimeException if entry at index does not have given tag
+         */
+        [[nodiscard]] static const ConstantPoolEntry& referencedEntry(const ConstantPool& constantPool,
+                                                                      u2 index,
+                                                                      ConstantPoolInfoTag tag);
+
+        [[nodiscard]] static Symbol utf8Symbol(const ConstantPool& constantPool, u2 index);
+
+        std::size_t m_slotCount;
+        std::unique_ptr<std::atomic<const ResolvedReference*>[]> m_resolved;
+
+        // Elements of std::deque are never relocated, so published pointers stay valid
+        std::deque<ResolvedReference> m_references;
+        std::mutex m_mutex;
+    };
+
+    /**
+     * Shared handle to a ResolutionCache which is only allocated when the first reference is resolved, so that
+     * classes which never resolve anything do not pay for it. Copies share the cache once it exists.
+     */
+    class LazyResolutionCache
+    {
+      public:
+        LazyResolutionCache() = default;
+        LazyResolutionCache(const LazyResolutionCache& other);
+        LazyResolutionCache& operator=(const LazyResolutionCache& other);
+
+        /**
+         * @see ResolutionCache::resolve
+         */
+        [[nodiscard]] const ResolvedReference& resolve(const ConstantPool& constantPool, u2 index) const;
+
+      protected:
+        // Accessed through the std::atomic_* free functions, std::atomic<std::shared_ptr> is not available in libc++
+        mutable std::shared_ptr<ResolutionCache> m_cache;
+    };
+} // namespace AeroJet::Java::ClassFile
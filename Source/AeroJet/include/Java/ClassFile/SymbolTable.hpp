@@ -0,0 +1,106 @@
+/*
+ * SymbolTable.hpp
+ *
+ * Copyright © 2024 AeroJet Developers. All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the “Software”), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+ * OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include "Types.hpp"
+
+#include <array>
+#include <cstddef>
+#include <deque>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace AeroJet::Java::ClassFile
+{
+    /**
+     * Identifier of an interned symbol. Equal symbols have equal identifiers for the lifetime of the SymbolTable.
+     */
+    using SymbolId = u4;
+
+    struct Symbol
+    {
+        SymbolId id;
+
+        /**
+         * Interned bytes in modified UTF-8, valid for the lifetime of the SymbolTable
+         */
+        std::string_view string;
+    };
+
+    /**
+     * Thread-safe interning table for CONSTANT_Utf8 strings. The same names and descriptors recur in nearly every
+     * class of a classpath, so each distinct string is stored once and identified by a 32-bit id, which turns name
+     * comparisons across classes into integer comparisons.
+     *
+     * The table is split into shards selected by the string hash, each guarded by its own reader-writer lock, so
+     * concurrent lookups of already interned strings do not contend. Interned strings are never released.
+     */
+    class SymbolTable
+    {
+      public:
+        SymbolTable() = default;
+        SymbolTable(const SymbolTable&) = delete;
+        SymbolTable& operator=(const SymbolTable&) = delete;
+
+        /**
+         * @brief Table shared by every parsed ClassInfo
+         */
+        static SymbolTable& global();
+
+        [[nodiscard]] Symbol intern(std::string_view string);
+
+        [[nodiscard]] std::optional<SymbolId> find(std::string_view string) const;
+
+        /**
+         * @throws Exceptions::RuntimeException if id was not produced by this table
+         */
+        [[nodiscard]] std::string_view symbol(SymbolId id) const;
+
+        /**
+         * @brief Number of distinct interned strings
+         */
+        [[nodiscard]] std::size_t size() const;
+
+        static constexpr std::size_t SHARD_BITS = 6;
+        static constexpr std::size_t SHARD_COUNT = 1 << SHARD_BITS;
+
+      protected:
+        struct Shard
+        {
+            mutable std::shared_mutex mutex;
+            std::unordered_map<std::string_view, SymbolId> ids;
+
+            // Elements of std::deque are never relocated, so views of the strings stay valid
+            std::deque<std::string> symbols;
+        };
+
+        static std::size_t shardIndex(std::string_view string);
+
+        std::array<Shard, SHARD_COUNT> m_shards;
+    };
+} // namespace AeroJet::Java::ClassFile
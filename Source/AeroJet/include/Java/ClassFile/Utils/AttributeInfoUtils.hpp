@@ -28,6 +28,7 @@
 #include "Java/ClassFile/ConstantPool.hpp"
 
 #include <string>
+#include <string_view>
 
 namespace AeroJet::Java::ClassFile::Utils
 {
@@ -43,5 +44,12 @@ namespace AeroJet::Java::ClassFile::Utils
          */
         [[nodiscard]] static std::string extractName(const ConstantPool& constantPool,
                                                      const AttributeInfo& attributeInfo);
+
+        /**
+         * @brief Same as extractName but without copying, attribute names are plain ASCII
+         * @return view of the interned name, valid for the lifetime of the process
+         */
+        [[nodiscard]] static std::string_view extractNameView(const ConstantPool& constantPool,
+                                                              const AttributeInfo& attributeInfo);
     };
 } // namespace AeroJet::Java::ClassFile::Utils
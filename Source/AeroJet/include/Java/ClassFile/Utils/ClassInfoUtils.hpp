@@ -28,6 +28,7 @@
 
 #include <filesystem>
 #include <string>
+#include <string_view>
 
 namespace AeroJet::Java::ClassFile::Utils
 {
@@ -50,6 +51,13 @@ namespace AeroJet::Java::ClassFile::Utils
          */
         [[nodiscard]] static std::string name(const ClassInfo& classInfo);
 
+        /**
+         * @brief Same as name but without copying or converting
+         * @return view of the interned name in modified UTF-8 (§4.4.7), valid at least as long as the ClassInfo.
+         * Differs from name only if the name contains U+0000 or supplementary characters.
+         */
+        [[nodiscard]] static std::string_view nameView(const ClassInfo& classInfo);
+
         /**
          * @brief Extracts short name of class from ClassInfo
          * @param classInfo
@@ -57,6 +65,13 @@ namespace AeroJet::Java::ClassFile::Utils
          */
         [[nodiscard]] static std::string className(const ClassInfo& classInfo);
 
+        /**
+         * @brief Same as className but without copying or converting
+         * @return view of the interned name in modified UTF-8 (§4.4.7), valid at least as long as the ClassInfo.
+         * Differs from className only if the name contains U+0000 or supplementary characters.
+         */
+        [[nodiscard]] static std::string_view classNameView(const ClassInfo& classInfo);
+
         [[nodiscard]] static std::string javaNameFromPath(const std::filesystem::path& path);
 
         /**
@@ -65,5 +80,12 @@ namespace AeroJet::Java::ClassFile::Utils
          * @return full name of given ClassInfo including package in Java format like org.project.ClassName
          */
         [[nodiscard]] static std::string javaName(const ClassInfo& classInfo);
+
+        /**
+         * @brief Same as javaName but writes into a caller provided buffer, so that it can be reused across classes
+         * @param storage buffer the name is written to
+         * @return view of storage
+         */
+        [[nodiscard]] static std::string_view javaName(const ClassInfo& classInfo, std::string& storage);
     };
 } // namespace AeroJet::Java::ClassFile::Utils
\ No newline at end of file
@@ -0,0 +1,75 @@
+/*
+ * ModifiedUtf8Utils.hpp
+ *
+ * Copyright © 2024 AeroJet Developers. All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the “Software”), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+ * OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include "Types.hpp"
+
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace AeroJet::Java::ClassFile::Utils
+{
+    /**
+     * Validation and conversion of the modified UTF-8 encoding used by CONSTANT_Utf8 entries (JVMS 4.4.7).
+     * It differs from standard UTF-8 in two ways: NUL is encoded as the two bytes C0 80, and supplementary characters
+     * are encoded as two separately encoded UTF-16 surrogates of three bytes each.
+     *
+     * Nearly all constant pool strings are ASCII, which is identical in both encodings, so every function scans for
+     * the ASCII prefix first using SSE2/AVX2 when the host supports it.
+     */
+    class ModifiedUtf8Utils
+    {
+      public:
+        /**
+         * @brief Length of the longest prefix made of single byte characters (0x01 - 0x7F)
+         */
+        static std::size_t asciiLength(std::span<const u1> bytes);
+
+        static bool isAscii(std::span<const u1> bytes);
+
+        /**
+         * @brief Checks that bytes are well-formed modified UTF-8
+         * @return offset of the first malformed byte, or nothing if bytes are valid
+         */
+        static std::optional<std::size_t> validate(std::span<const u1> bytes);
+
+        /**
+         * @brief Converts bytes to standard UTF-8. Unpaired surrogates are replaced by U+FFFD.
+         * @return view of bytes themselves if they are ASCII, otherwise view of storage holding the converted string
+         * @throws Exceptions::RuntimeException if bytes are not valid modified UTF-8
+         */
+        static std::string_view toUtf8(std::span<const u1> bytes, std::string& storage);
+
+        static std::string toUtf8(std::span<const u1> bytes);
+
+        /**
+         * @throws Exceptions::RuntimeException if bytes are not valid modified UTF-8
+         */
+        static std::u16string toUtf16(std::span<const u1> bytes);
+    };
+} // namespace AeroJet::Java::ClassFile::Utils
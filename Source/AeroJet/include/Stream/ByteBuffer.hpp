@@ -0,0 +1,167 @@
+/*
+ * ByteBuffer.hpp
+ *
+ * Copyright © 2024 AeroJet Developers. All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the “Software”), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+ * OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include "Stream/ByteSwap.hpp"
+#include "Stream/Stream.hpp"
+#include "Types.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <ostream>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace AeroJet::Stream
+{
+    /**
+     * Growable contiguous output buffer, the writing counterpart of ByteCursor.
+     *
+     * Values are stored directly into the buffer without going through std::ostream, multibyte values are written
+     * as big-endian (class file order) unless the byte order is given explicitly. The content may be released as a
+     * std::vector<u1> without copying or flushed to a stream with a single write call.
+     */
+    class ByteBuffer
+    {
+      public:
+        ByteBuffer() = default;
+
+        explicit ByteBuffer(std::size_t capacity)
+        {
+            reserve(capacity);
+        }
+
+        [[nodiscard]] inline std::span<const u1> bytes() const
+        {
+            return { m_bytes.data(), m_size };
+        }
+
+        [[nodiscard]] inline const u1* data() const
+        {
+            return m_bytes.data();
+        }
+
+        [[nodiscard]] inline std::size_t size() const
+        {
+            return m_size;
+        }
+
+        [[nodiscard]] inline std::size_t capacity() const
+        {
+            return m_bytes.size();
+        }
+
+        [[nodiscard]] inline bool empty() const
+        {
+            return m_size == 0;
+        }
+
+        inline void reserve(std::size_t capacity)
+        {
+            if(capacity > m_bytes.size())
+            {
+                m_bytes.resize(capacity);
+            }
+        }
+
+        inline void clear()
+        {
+            m_size = 0;
+        }
+
+        /**
+         * @brief Appends count bytes and returns pointer to them. The pointer is valid until the next append.
+         */
+        [[nodiscard]] inline u1* grow(std::size_t count)
+        {
+            if(m_size + count > m_bytes.size())
+            {
+                m_bytes.resize(std::max(m_size + count, m_bytes.size() * 2));
+            }
+
+            u1* destination = m_bytes.data() + m_size;
+            m_size += count;
+
+            return destination;
+        }
+
+        template<typename T>
+        inline void write(T value)
+            requires std::is_arithmetic_v<T>
+        {
+            storeBigEndian(grow(sizeof(T)), value);
+        }
+
+        template<ByteOrder byteOrder, typename T>
+        inline void write(T value)
+            requires std::is_arithmetic_v<T>
+        {
+            value = applyByteOrder<byteOrder>(value);
+            std::memcpy(grow(sizeof(T)), &value, sizeof(T));
+        }
+
+        /**
+         * @brief Appends values as big-endian with a single bulk byte swap
+         */
+        template<typename T>
+        inline void writeArray(std::span<const T> values)
+            requires std::is_arithmetic_v<T>
+        {
+            storeBigEndianArray(values.data(), grow(values.size_bytes()), values.size());
+        }
+
+        inline void append(std::span<const u1> bytes)
+        {
+            if(!bytes.empty())
+            {
+                std::memcpy(grow(bytes.size()), bytes.data(), bytes.size());
+            }
+        }
+
+        inline void writeTo(std::ostream& stream) const
+        {
+            stream.write(reinterpret_cast<const char*>(m_bytes.data()), static_cast<std::streamsize>(m_size));
+        }
+
+        /**
+         * @brief Moves the written bytes out of the buffer, leaving it empty
+         */
+        [[nodiscard]] inline std::vector<u1> release()
+        {
+            m_bytes.resize(m_size);
+            m_size = 0;
+
+            std::vector<u1> bytes = std::move(m_bytes);
+            m_bytes.clear();
+
+            return bytes;
+        }
+
+      private:
+        std::vector<u1> m_bytes;
+        std::size_t m_size = 0;
+    };
+} // namespace AeroJet::Stream
@@ -0,0 +1,198 @@
+/*
+ * ByteCursor.hpp
+ *
+ * Copyright © 2024 AeroJet Developers. All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the “Software”), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+ * OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include "Exceptions/RuntimeException.hpp"
+#include "fmt/format.h"
+#include "Stream/ByteSwap.hpp"
+#include "Stream/Stream.hpp"
+#include "Types.hpp"
+
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace AeroJet::Stream
+{
+    /**
+     * Forward-only reader over a contiguous byte buffer.
+     *
+     * Class file structures are always stored in big-endian order, so ByteCursor decodes every multibyte value
+     * as big-endian regardless of the host byte order. Bounds are checked either per read (read<T>) or once for a
+     * whole fixed-size structure (require + readUnchecked<T>).
+     *
+     * ByteCursor does not own the underlying buffer, the caller is responsible for keeping it alive. When the buffer
+     * is owned by a shared storage (mapped file, loaded class bytes), the storage may be attached to the cursor so that
+     * readers are able to keep views into the buffer instead of copying it (see AttributeInfo).
+     */
+    class ByteCursor
+    {
+      public:
+        ByteCursor() = default;
+
+        explicit ByteCursor(std::span<const u1> bytes) :
+            m_bytes(bytes), m_position(0)
+        {
+        }
+
+        ByteCursor(std::span<const u1> bytes, std::shared_ptr<const void> owner) :
+            m_bytes(bytes), m_position(0), m_owner(std::move(owner))
+        {
+        }
+
+        /**
+         * @brief Storage which keeps the underlying buffer alive, nullptr if the buffer is not shared
+         */
+        [[nodiscard]] inline const std::shared_ptr<const void>& owner() const
+        {
+            return m_owner;
+        }
+
+        [[nodiscard]] inline std::span<const u1> bytes() const
+        {
+            return m_bytes;
+        }
+
+        [[nodiscard]] inline std::size_t position() const
+        {
+            return m_position;
+        }
+
+        [[nodiscard]] inline std::size_t size() const
+        {
+            return m_bytes.size();
+        }
+
+        [[nodiscard]] inline std::size_t remaining() const
+        {
+            return m_bytes.size() - m_position;
+        }
+
+        [[nodiscard]] inline bool eof() const
+        {
+            return m_position >= m_bytes.size();
+        }
+
+        /**
+         * @brief Non-throwing check that at least count bytes can be read from the current position
+         */
+        [[nodiscard]] inline bool canRead(std::size_t count) const
+        {
+            return count <= remaining();
+        }
+
+        /**
+         * @brief Verifies that at least count bytes can be read from the current position
+         * @throws Exceptions::RuntimeException if there are less than count bytes available
+         */
+        inline void require(std::size_t count) const
+        {
+            if(count > remaining())
+            {
+                throw Exceptions::RuntimeException(
+                    fmt::format("Attempt to read {} bytes at {:#08x} while {} is available", count, m_position, remaining()));
+            }
+        }
+
+        inline void seek(std::size_t position)
+        {
+            if(position > m_bytes.size())
+            {
+                throw Exceptions::RuntimeException(
+                    fmt::format("Attempt to seek to {:#08x} while size is {:#08x}", position, m_bytes.size()));
+            }
+
+            m_position = position;
+        }
+
+        inline void skip(std::size_t count)
+        {
+            require(count);
+            m_position += count;
+        }
+
+        template<typename T>
+        [[nodiscard]] inline T read()
+            requires std::is_arithmetic_v<T>
+        {
+            require(sizeof(T));
+            return readUnchecked<T>();
+        }
+
+        /**
+         * @brief Reads a value without bounds checking. Must be preceded by require() covering the read.
+         */
+        template<typename T>
+        [[nodiscard]] inline T readUnchecked()
+            requires std::is_arithmetic_v<T>
+        {
+            const T value = loadBigEndian<T>(m_bytes.data() + m_position);
+            m_position += sizeof(T);
+
+            return value;
+        }
+
+        /**
+         * @brief Decodes destination.size() consecutive values in a single bounds check and bulk byte swap
+         */
+        template<typename T>
+        inline void readArray(std::span<T> destination)
+            requires std::is_arithmetic_v<T>
+        {
+            const std::span<const u1> bytes = readBytes(destination.size_bytes());
+            loadBigEndianArray(bytes.data(), destination.data(), destination.size());
+        }
+
+        template<typename T>
+        [[nodiscard]] inline std::vector<T> readArray(std::size_t count)
+            requires std::is_arithmetic_v<T>
+        {
+            require(count * sizeof(T));
+
+            std::vector<T> values(count);
+            readArray(std::span<T>{ values });
+
+            return values;
+        }
+
+        /**
+         * @brief Returns view of the next count bytes and advances the cursor past them
+         */
+        [[nodiscard]] inline std::span<const u1> readBytes(std::size_t count)
+        {
+            require(count);
+            std::span<const u1> bytes = m_bytes.subspan(m_position, count);
+            m_position += count;
+
+            return bytes;
+        }
+
+      private:
+        std::span<const u1> m_bytes;
+        std::size_t m_position = 0;
+        std::shared_ptr<const void> m_owner;
+    };
+} // namespace AeroJet::Stream
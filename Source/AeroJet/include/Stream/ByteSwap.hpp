@@ -0,0 +1,131 @@
+/*
+ * ByteSwap.hpp
+ *
+ * Copyright © 2024 AeroJet Developers. All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the “Software”), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+ * OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include "Stream/Stream.hpp"
+#include "Types.hpp"
+
+#include <bit>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+namespace AeroJet::Stream
+{
+    /**
+     * @brief Reverses byte order of count 16-bit elements. Uses SSSE3/AVX2 shuffles when the host supports them.
+     * Source and destination may be the same buffer, but must not partially overlap. Neither has to be aligned.
+     */
+    void swapEndianArray16(const void* source, void* destination, std::size_t count);
+
+    /**
+     * @brief Reverses byte order of count 32-bit elements. Same requirements as swapEndianArray16.
+     */
+    void swapEndianArray32(const void* source, void* destination, std::size_t count);
+
+    /**
+     * @brief Decodes count big-endian values from source into destination
+     */
+    template<typename T>
+    inline void loadBigEndianArray(const u1* source, T* destination, std::size_t count)
+        requires std::is_arithmetic_v<T>
+    {
+        if constexpr(sizeof(T) == sizeof(u1) || BIG_ENDIAN_BYTE_ORDER == ByteOrder::DEFAULT)
+        {
+            std::memcpy(destination, source, count * sizeof(T));
+        }
+        else if constexpr(sizeof(T) == sizeof(u2))
+        {
+            swapEndianArray16(source, destination, count);
+        }
+        else if constexpr(sizeof(T) == sizeof(u4))
+        {
+            swapEndianArray32(source, destination, count);
+        }
+        else
+        {
+            for(std::size_t index = 0; index < count; index++)
+            {
+                destination[index] = loadBigEndian<T>(source + index * sizeof(T));
+            }
+        }
+    }
+
+    /**
+     * @brief Encodes count values from source as big-endian into destination
+     */
+    template<typename T>
+    inline void storeBigEndianArray(const T* source, u1* destination, std::size_t count)
+        requires std::is_arithmetic_v<T>
+    {
+        if constexpr(sizeof(T) == sizeof(u1) || BIG_ENDIAN_BYTE_ORDER == ByteOrder::DEFAULT)
+        {
+            std::memcpy(destination, source, count * sizeof(T));
+        }
+        else if constexpr(sizeof(T) == sizeof(u2))
+        {
+            swapEndianArray16(source, destination, count);
+        }
+        else if constexpr(sizeof(T) == sizeof(u4))
+        {
+            swapEndianArray32(source, destination, count);
+        }
+        else
+        {
+            for(std::size_t index = 0; index < count; index++)
+            {
+                storeBigEndian(destination + index * sizeof(T), source[index]);
+            }
+        }
+    }
+
+    /**
+     * @brief Applies byte order to count values in place
+     */
+    template<ByteOrder byteOrder, typename T>
+    inline void applyByteOrderArray(T* data, std::size_t count)
+        requires std::is_arithmetic_v<T>
+    {
+        if constexpr(byteOrder == ByteOrder::DEFAULT || sizeof(T) == sizeof(u1))
+        {
+            return;
+        }
+        else if constexpr(sizeof(T) == sizeof(u2))
+        {
+            swapEndianArray16(data, data, count);
+        }
+        else if constexpr(sizeof(T) == sizeof(u4))
+        {
+            swapEndianArray32(data, data, count);
+        }
+        else
+        {
+            for(std::size_t index = 0; index < count; index++)
+            {
+                data[index] = swapEndian(data[index]);
+            }
+        }
+    }
+} // namespace AeroJet::Stream
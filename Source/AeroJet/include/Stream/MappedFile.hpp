@@ -0,0 +1,67 @@
+/*
+ * MappedFile.hpp
+ *
+ * Copyright © 2024 AeroJet Developers. All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the “Software”), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+ * OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include "Types.hpp"
+
+#include <filesystem>
+#include <span>
+
+namespace AeroJet::Stream
+{
+    /**
+     * Read-only memory mapping of a whole file.
+     * The mapping is released when the object is destroyed, views returned by bytes() must not outlive it.
+     */
+    class MappedFile
+    {
+      public:
+        explicit MappedFile(const std::filesystem::path& path);
+        MappedFile(const MappedFile& other) = delete;
+        MappedFile(MappedFile&& other) noexcept;
+        ~MappedFile();
+
+        MappedFile& operator=(const MappedFile& other) = delete;
+        MappedFile& operator=(MappedFile&& other) noexcept;
+
+        [[nodiscard]] const std::filesystem::path& path() const;
+
+        [[nodiscard]] std::span<const u1> bytes() const;
+
+        [[nodiscard]] std::size_t size() const;
+
+      protected:
+        void unmap();
+
+      protected:
+        std::filesystem::path m_path;
+        const u1* m_data;
+        std::size_t m_size;
+#ifdef _WIN32
+        void* m_fileHandle;
+        void* m_mappingHandle;
+#endif
+    };
+} // namespace AeroJet::Stream
@@ -0,0 +1,71 @@
+/*
+ * ReadError.hpp
+ *
+ * Copyright © 2024 AeroJet Developers. All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the “Software”), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+ * OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include "Expected.hpp"
+#include "Types.hpp"
+
+#include <cstddef>
+#include <string_view>
+
+namespace AeroJet::Stream
+{
+    enum class ReadErrorCode : u1
+    {
+        UNEXPECTED_END,
+        NOT_A_CLASS_FILE,
+        UNSUPPORTED_CLASS_VERSION,
+        UNKNOWN_CONSTANT_POOL_TAG,
+        UNKNOWN_OPCODE,
+        UNEXPECTED_WIDE_OPCODE,
+        INVALID_SWITCH,
+        MALFORMED_MODIFIED_UTF8,
+        INVALID_CONSTANT_POOL_INDEX
+    };
+
+    /**
+     * Describes why a structure could not be decoded. Cheap to create and copy, so that malformed input can be
+     * rejected without exceptions or message formatting.
+     */
+    struct ReadError
+    {
+        ReadErrorCode code;
+
+        /**
+         * Offset of the offending data from the start of the decoded buffer
+         */
+        std::size_t offset;
+
+        [[nodiscard]] std::string_view description() const;
+    };
+
+    template<typename T>
+    using ReadResult = Expected<T, ReadError>;
+
+    [[nodiscard]] inline Unexpected<ReadError> readError(ReadErrorCode code, std::size_t offset)
+    {
+        return Unexpected<ReadError>{ ReadError{ code, offset } };
+    }
+} // namespace AeroJet::Stream
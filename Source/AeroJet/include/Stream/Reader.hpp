@@ -24,14 +24,180 @@
 
 #pragma once
 
+#include "ByteCursor.hpp"
+#include "Exceptions/RuntimeException.hpp"
+#include "fmt/format.h"
 #include "Java/ByteCode/Instruction.hpp"
+#include "ReadError.hpp"
 #include "Stream.hpp"
 #include "Types.hpp"
 
 #include <istream>
+#include <limits>
+#include <type_traits>
+#include <vector>
 
 namespace AeroJet::Stream::Reader
 {
     template<typename T>
     T read(std::istream& stream, ByteOrder byteOrder);
-}
+
+    /**
+     * @brief Reads arithmetic value from the stream. Byte order is resolved at compile time.
+     */
+    template<typename T, ByteOrder byteOrder>
+    T read(std::istream& stream)
+        requires std::is_arithmetic_v<T>
+    {
+        if(stream.eof())
+        {
+            throw Exceptions::RuntimeException(
+                fmt::format("stream EOF at {:#08x}! Read size was {}", static_cast<std::size_t>(stream.tellg()), sizeof(T)));
+        }
+
+        T value{};
+        stream.read(reinterpret_cast<char*>(&value), sizeof(T));
+
+        const std::size_t readCount = static_cast<std::size_t>(stream.gcount());
+        if(readCount != sizeof(T))
+        {
+            throw Exceptions::RuntimeException(
+                fmt::format("Attempt to read {} bytes while {} is available", sizeof(T), readCount));
+        }
+
+        return applyByteOrder<byteOrder>(value);
+    }
+
+    /**
+     * Class file structures are decoded from contiguous memory. Every multibyte value is read as big-endian.
+     */
+    template<typename T>
+    T read(ByteCursor& cursor);
+
+    /**
+     * Non-throwing counterpart of read(ByteCursor&) for class file structures. Malformed input is reported as
+     * ReadError with the offset of the offending data, without unwinding or formatting an error message.
+     * The cursor position is unspecified after a failure.
+     */
+    template<typename T>
+    ReadResult<T> tryRead(ByteCursor& cursor);
+
+    /**
+     * @brief Unwraps the result of tryRead
+     * @throws Exceptions::RuntimeException describing the error if result does not hold a value
+     */
+    template<typename T>
+    T valueOrThrow(ReadResult<T>&& result)
+    {
+        if(!result)
+        {
+            throw Exceptions::RuntimeException(
+                fmt::format("{} at {:#08x}", result.error().description(), result.error().offset));
+        }
+
+        return std::move(result).value();
+    }
+
+    template<>
+    inline i1 read(ByteCursor& cursor)
+    {
+        return cursor.read<i1>();
+    }
+
+    template<>
+    inline i2 read(ByteCursor& cursor)
+    {
+        return cursor.read<i2>();
+    }
+
+    template<>
+    inline i4 read(ByteCursor& cursor)
+    {
+        return cursor.read<i4>();
+    }
+
+    template<>
+    inline i8 read(ByteCursor& cursor)
+    {
+        return cursor.read<i8>();
+    }
+
+    template<>
+    inline u1 read(ByteCursor& cursor)
+    {
+        return cursor.read<u1>();
+    }
+
+    template<>
+    inline u2 read(ByteCursor& cursor)
+    {
+        return cursor.read<u2>();
+    }
+
+    template<>
+    inline u4 read(ByteCursor& cursor)
+    {
+        return cursor.read<u4>();
+    }
+
+    template<>
+    inline u8 read(ByteCursor& cursor)
+    {
+        return cursor.read<u8>();
+    }
+
+    /**
+     * @brief Appends up to count bytes of the stream to bytes
+     * @return false if the stream ended before count bytes were read
+     */
+    bool readChunk(std::istream& stream, std::vector<u1>& bytes, std::size_t count);
+
+    /**
+     * @brief Decodes T from memory, buffering the stream in growing chunks until the structure fits.
+     * Reading a structure costs time proportional to its size, not to the rest of the stream. The stream is
+     * positioned right after the decoded structure. Streams which cannot seek are buffered to the end.
+     */
+    template<typename T>
+    T readBuffered(std::istream& stream)
+    {
+        static constexpr std::size_t INITIAL_CHUNK_SIZE = 64;
+
+        const std::istream::pos_type startPosition = stream.tellg();
+        const bool seekable = startPosition != std::istream::pos_type(-1);
+
+        // tableswitch and lookupswitch are padded relative to the start of the stream, the buffer keeps its alignment
+        const std::size_t alignment = seekable ? static_cast<std::size_t>(startPosition) % 4 : 0;
+        std::vector<u1> bytes(alignment);
+
+        std::size_t chunkSize = seekable ? INITIAL_CHUNK_SIZE : std::numeric_limits<std::size_t>::max();
+        while(true)
+        {
+            const bool exhausted = !readChunk(stream, bytes, chunkSize);
+
+            ByteCursor cursor{ bytes };
+            cursor.skip(alignment);
+            try
+            {
+                T object = read<T>(cursor);
+
+                stream.clear();
+                if(seekable)
+                {
+                    stream.seekg(startPosition + static_cast<std::streamoff>(cursor.position() - alignment));
+                }
+
+                return object;
+            }
+            catch(const Exceptions::RuntimeException&)
+            {
+                // Malformed or truncated structure
+                if(exhausted)
+                {
+                    throw;
+                }
+            }
+
+            chunkSize *= 2;
+        }
+    }
+} // namespace AeroJet::Stream::Reader
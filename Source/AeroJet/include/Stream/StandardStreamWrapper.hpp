@@ -3,6 +3,8 @@
 #include "Assertion.hpp"
 #include "Exceptions/RuntimeException.hpp"
 #include "fmt/format.h"
+#include "Stream/ByteSwap.hpp"
+#include "Stream/Stream.hpp"
 #include "Types.hpp"
 
 #include <array>
@@ -41,12 +43,6 @@ namespace AeroJet::Stream
                std::is_same_v<T, std::wfstream>;
     }
 
-    enum class ByteOrder : uint8_t
-    {
-        NORMAL,
-        REVERSE
-    };
-
     template<class T>
     concept StandardInputStream = isStandardInputStream<T>() || isStandardInputOutputStream<T>();
 
@@ -56,17 +52,17 @@ namespace AeroJet::Stream
     template<class T>
     concept StandardInputOutputStream = isStandardInputOutputStream<T>();
 
-    template<typename TStream, ByteOrder ReadMode = ByteOrder::NORMAL, ByteOrder WriteMode = ByteOrder::NORMAL>
+    template<typename TStream, ByteOrder ReadMode = ByteOrder::DEFAULT, ByteOrder WriteMode = ByteOrder::DEFAULT>
     class StandardStreamWrapper;
 
-    template<typename T, typename TStream, ByteOrder ReadMode = ByteOrder::NORMAL, ByteOrder WriteMode = ByteOrder::NORMAL>
+    template<typename T, typename TStream, ByteOrder ReadMode = ByteOrder::DEFAULT, ByteOrder WriteMode = ByteOrder::DEFAULT>
     concept Readable = requires(StandardStreamWrapper<TStream, ReadMode, WriteMode>& stream) {
         {
             T::read(stream)
         } -> std::same_as<T>;
     };
 
-    template<typename T, typename TStream, ByteOrder ReadMode = ByteOrder::NORMAL, ByteOrder WriteMode = ByteOrder::NORMAL>
+    template<typename T, typename TStream, ByteOrder ReadMode = ByteOrder::DEFAULT, ByteOrder WriteMode = ByteOrder::DEFAULT>
     concept Writable = requires(T& object, StandardStreamWrapper<TStream, ReadMode, WriteMode>& stream) {
         {
             object.write(stream)
@@ -168,10 +164,7 @@ namespace AeroJet::Stream
             requires(StandardInputStream<TStream> || StandardInputOutputStream<TStream>) && std::is_fundamental_v<T>
         {
             std::array<T, size> array{};
-            for(std::size_t index = 0; index < size; index++)
-            {
-                array[index] = read<T>();
-            }
+            readArrayInternal(array.data(), size);
 
             return array;
         }
@@ -193,12 +186,8 @@ namespace AeroJet::Stream
         [[nodiscard]] inline std::vector<T> readSome(std::size_t count)
             requires(StandardInputStream<TStream> || StandardInputOutputStream<TStream>) && std::is_fundamental_v<T>
         {
-            std::vector<T> vector{};
-            vector.reserve(count);
-            for(std::size_t index = 0; index < count; index++)
-            {
-                vector.emplace_back(read<T>());
-            }
+            std::vector<T> vector(count);
+            readArrayInternal(vector.data(), count);
 
             return vector;
         }
@@ -274,52 +263,34 @@ namespace AeroJet::Stream
             T read{};
             m_stream.read(reinterpret_cast<CharType*>(&read), readSize);
 
-            if constexpr(ReadMode == ByteOrder::REVERSE)
-            {
-                read = swapEndian(read);
-            }
+            return applyByteOrder<ReadMode>(read);
+        }
+
+        template<typename T>
+        inline void readArrayInternal(T* data, std::size_t count)
+        {
+            AEROJET_VERIFY_THROW(isOpen(), Exceptions::RuntimeException, "Stream is not open!");
 
-            return read;
+            const std::size_t readSize = sizeof(T) * count;
+            const std::size_t readPos = readPosition();
+
+            AEROJET_VERIFY_THROW(readPos + readSize <= m_size, Exceptions::RuntimeException, fmt::format("Attempt to read {} bytes while {} is available", readSize, m_size - readPos));
+
+            m_stream.read(reinterpret_cast<CharType*>(data), readSize);
+            applyByteOrderArray<ReadMode>(data, count);
         }
 
         template<typename T>
         inline void writeInternal(T data)
             requires StandardOutputStream<TStream> || StandardInputOutputStream<TStream>
         {
-            if constexpr(WriteMode == ByteOrder::REVERSE)
-            {
-                data = swapEndian(data);
-            }
+            data = applyByteOrder<WriteMode>(data);
 
             std::size_t size = sizeof(data);
             m_stream.write(reinterpret_cast<CharType*>(&data), size);
             m_size += size;
         }
 
-        template<typename T>
-        static T swapEndian(const T& data)
-        {
-            static_assert(CHAR_BIT == 8, "CHAR_BIT != 8");
-
-            union ByteObjectRepresentation
-            {
-                T object;
-                std::array<u1, sizeof(T)> bytes;
-            };
-
-            ByteObjectRepresentation source{};
-            ByteObjectRepresentation dst{};
-
-            source.object = data;
-
-            for(size_t k = 0; k < sizeof(T); k++)
-            {
-                dst.bytes[k] = source.bytes[sizeof(T) - k - 1];
-            }
-
-            return dst.object;
-        }
-
       private:
         TStream m_stream;
         std::size_t m_size;
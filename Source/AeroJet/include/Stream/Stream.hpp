@@ -26,9 +26,16 @@
 
 #include "Types.hpp"
 
+#include <bit>
 #include <climits>
 #include <cstddef>
+#include <cstring>
 #include <sstream>
+#include <type_traits>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+    #include <stdlib.h>
+#endif
 
 namespace AeroJet::Stream
 {
@@ -40,27 +47,90 @@ namespace AeroJet::Stream
 
     using MemoryStream = std::stringstream;
 
+    /**
+     * @brief Reverses byte order of the value. Lowers to a single bswap (or movbe when fused with a load/store).
+     */
     template<typename T>
-    static T swapEndian(const T& data)
+    [[nodiscard]] inline T swapEndian(T value)
+        requires std::is_arithmetic_v<T>
     {
         static_assert(CHAR_BIT == 8, "CHAR_BIT != 8");
 
-        union ByteObjectRepresentation
+        if constexpr(sizeof(T) == sizeof(u1))
         {
-            T object;
-            unsigned char bytes[sizeof(T)];
-        };
-
-        ByteObjectRepresentation source{};
-        ByteObjectRepresentation dst{};
-
-        source.object = data;
+            return value;
+        }
+        else if constexpr(sizeof(T) == sizeof(u2))
+        {
+#if defined(_MSC_VER) && !defined(__clang__)
+            return std::bit_cast<T>(_byteswap_ushort(std::bit_cast<u2>(value)));
+#else
+            return std::bit_cast<T>(__builtin_bswap16(std::bit_cast<u2>(value)));
+#endif
+        }
+        else if constexpr(sizeof(T) == sizeof(u4))
+        {
+#if defined(_MSC_VER) && !defined(__clang__)
+            return std::bit_cast<T>(static_cast<u4>(_byteswap_ulong(std::bit_cast<u4>(value))));
+#else
+            return std::bit_cast<T>(__builtin_bswap32(std::bit_cast<u4>(value)));
+#endif
+        }
+        else
+        {
+            static_assert(sizeof(T) == sizeof(u8), "Unsupported size of swapped type");
+#if defined(_MSC_VER) && !defined(__clang__)
+            return std::bit_cast<T>(static_cast<u8>(_byteswap_uint64(std::bit_cast<u8>(value))));
+#else
+            return std::bit_cast<T>(__builtin_bswap64(std::bit_cast<u8>(value)));
+#endif
+        }
+    }
 
-        for(size_t k = 0; k < sizeof(T); k++)
+    /**
+     * @brief Converts value between host byte order and given byte order. Resolved at compile time.
+     */
+    template<ByteOrder byteOrder, typename T>
+    [[nodiscard]] inline T applyByteOrder(T value)
+        requires std::is_arithmetic_v<T>
+    {
+        if constexpr(byteOrder == ByteOrder::INVERSE)
         {
-            dst.bytes[k] = source.bytes[sizeof(T) - k - 1];
+            return swapEndian(value);
         }
+        else
+        {
+            return value;
+        }
+    }
 
-        return dst.object;
+    /**
+     * Byte order which has to be applied to host values to get big-endian (class file) representation.
+     */
+    inline constexpr ByteOrder BIG_ENDIAN_BYTE_ORDER =
+        std::endian::native == std::endian::little ? ByteOrder::INVERSE : ByteOrder::DEFAULT;
+
+    /**
+     * @brief Loads big-endian value from possibly unaligned memory
+     */
+    template<typename T>
+    [[nodiscard]] inline T loadBigEndian(const u1* data)
+        requires std::is_arithmetic_v<T>
+    {
+        T value;
+        std::memcpy(&value, data, sizeof(T));
+
+        return applyByteOrder<BIG_ENDIAN_BYTE_ORDER>(value);
+    }
+
+    /**
+     * @brief Stores value as big-endian into possibly unaligned memory
+     */
+    template<typename T>
+    inline void storeBigEndian(u1* data, T value)
+        requires std::is_arithmetic_v<T>
+    {
+        value = applyByteOrder<BIG_ENDIAN_BYTE_ORDER>(value);
+        std::memcpy(data, &value, sizeof(T));
     }
 } // namespace AeroJet::Stream
@@ -27,22 +27,31 @@
 #include "Stream.hpp"
 
 #include <ostream>
+#include <type_traits>
 
 namespace AeroJet::Stream::Writer
 {
+    /**
+     * @brief Writes arithmetic value to the stream. Byte order is resolved at compile time.
+     */
+    template<ByteOrder byteOrder, typename T>
+    inline void write(std::ostream& stream, T object)
+        requires std::is_arithmetic_v<T>
+    {
+        const T value = applyByteOrder<byteOrder>(object);
+        stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
     template<typename T>
     inline void write(std::ostream& stream, T object, ByteOrder byteOrder = ByteOrder::DEFAULT)
     {
-        constexpr size_t size = sizeof(object);
-
-        if(size > 1 && byteOrder == ByteOrder::INVERSE)
+        if(byteOrder == ByteOrder::INVERSE)
         {
-            T obj = swapEndian(object);
-            stream.write((char*)&obj, sizeof(object));
+            write<ByteOrder::INVERSE>(stream, object);
         }
         else
         {
-            stream.write((char*)&object, sizeof(object));
+            write<ByteOrder::DEFAULT>(stream, object);
         }
     }
 } // namespace AeroJet::Stream::Writer
@@ -0,0 +1,72 @@
+/*
+ * TableView.hpp
+ *
+ * Copyright © 2024 AeroJet Developers. All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the “Software”), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+ * OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace AeroJet::Utils
+{
+    /**
+     * Read-only view of a table of a parsed structure. Tables live in the memory resource the structure was parsed
+     * with, so they are not std::vector, the view converts to one to keep callers which bind accessors to
+     * const std::vector<T>& compiling, at the cost of a copy.
+     */
+    template<typename T>
+    class TableView : public std::span<const T>
+    {
+      public:
+        using std::span<const T>::span;
+
+        TableView(std::span<const T> table) :
+            std::span<const T>(table)
+        {
+        }
+
+        [[nodiscard]] const T& at(std::size_t position) const
+        {
+            if(position >= this->size())
+            {
+                throw std::out_of_range("TableView::at");
+            }
+
+            return (*this)[position];
+        }
+
+        operator std::vector<T>() const
+        {
+            return { this->begin(), this->end() };
+        }
+
+        [[nodiscard]] friend bool operator==(const TableView& first, const TableView& second)
+            requires std::equality_comparable<T>
+        {
+            return std::equal(first.begin(), first.end(), second.begin(), second.end());
+        }
+    };
+} // namespace AeroJet::Utils
@@ -79,16 +79,37 @@ namespace AeroJet::Java::Archive
 
     Stream::MemoryStream Jar::Entry::read() const
     {
-        const u8 bufferSize = zip_entry_size(m_zip);
-        auto* const buffer = static_cast<u1*>(calloc(sizeof(u1), bufferSize));
-        zip_entry_noallocread(m_zip, buffer, bufferSize);
+        const std::vector<u1> buffer = bytes();
 
         Stream::MemoryStream ss;
-        std::move(&buffer[0], &buffer[bufferSize], std::ostream_iterator<u1>(ss));
+        ss.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
 
         return ss;
     }
 
+    std::vector<u1> Jar::Entry::bytes() const
+    {
+        std::vector<u1> buffer;
+        readInto(buffer);
+
+        return buffer;
+    }
+
+    void Jar::Entry::readInto(std::vector<u1>& buffer) const
+    {
+        const u8 bufferSize = zip_entry_size(m_zip);
+        buffer.resize(bufferSize);
+
+        const ssize_t readSize = zip_entry_noallocread(m_zip, buffer.data(), buffer.size());
+        if(readSize < 0)
+        {
+            throw Exceptions::RuntimeException(
+                fmt::format("Failed to read entry \"{}\"! Error: {}", m_name, readSize));
+        }
+
+        buffer.resize(static_cast<std::size_t>(readSize));
+    }
+
     std::string_view Jar::Entry::name() const
     {
         return m_name;
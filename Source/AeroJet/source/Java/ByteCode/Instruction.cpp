@@ -25,12 +25,10 @@
 #include "Java/ByteCode/Instruction.hpp"
 
 #include "Exceptions/OperationNotSupportedException.hpp"
-#include "Exceptions/RuntimeException.hpp"
-#include "fmt/format.h"
 #include "Java/ByteCode/OpCodes.hpp"
+#include "Stream/ByteBuffer.hpp"
+#include "Stream/ReadError.hpp"
 #include "Stream/Reader.hpp"
-#include "Stream/StreamUtils.hpp"
-#include "Stream/Writer.hpp"
 
 namespace AeroJet::Java::ByteCode
 {
@@ -38,7 +36,12 @@ namespace AeroJet::Java::ByteCode
         m_opCode(opCode) {}
 
     Instruction::Instruction(OperationCode opCode, std::vector<u1>&& data) :
-        m_opCode(opCode), m_data(std::move(data))
+        m_opCode(opCode), m_data(data.begin(), data.end())
+    {
+    }
+
+    Instruction::Instruction(OperationCode opCode, std::span<const u1> data, std::pmr::memory_resource* memoryResource) :
+        m_opCode(opCode), m_data(data.begin(), data.end(), memoryResource)
     {
     }
 
@@ -47,19 +50,32 @@ namespace AeroJet::Java::ByteCode
         return m_opCode;
     }
 
-    const std::vector<u1>& Instruction::data() const
+    AeroJet::Utils::TableView<u1> Instruction::data() const
     {
         return m_data;
     }
 } // namespace AeroJet::Java::ByteCode
 
-template<>
-AeroJet::Java::ByteCode::Instruction AeroJet::Stream::Reader::read(std::istream& stream, ByteOrder byteOrder)
+AeroJet::Stream::ReadResult<AeroJet::Java::ByteCode::Instruction> AeroJet::Java::ByteCode::Instruction::tryRead(
+    Stream::ByteCursor& cursor,
+    Stream::ByteBuffer& operands,
+    std::pmr::memory_resource* memoryResource)
 {
-    Stream::MemoryStream dataStream;
+    using Stream::readError;
+    using Stream::ReadErrorCode;
+
+    if(!cursor.canRead(sizeof(AeroJet::u1)))
+    {
+        return readError(ReadErrorCode::UNEXPECTED_END, cursor.position());
+    }
 
+    const std::size_t opCodePosition = cursor.position();
     const AeroJet::Java::ByteCode::OperationCode opCode =
-        static_cast<AeroJet::Java::ByteCode::OperationCode>(AeroJet::Stream::Reader::read<u1>(stream, byteOrder));
+        static_cast<AeroJet::Java::ByteCode::OperationCode>(cursor.readUnchecked<AeroJet::u1>());
+
+    Stream::ByteBuffer& data = operands;
+    data.clear();
+    std::size_t operandsSize = 0;
 
     switch(opCode)
     {
@@ -225,7 +241,7 @@ AeroJet::Java::ByteCode::Instruction AeroJet::Stream::Reader::read(std::istream&
         case AeroJet::Java::ByteCode::OperationCode::lstore:
         case AeroJet::Java::ByteCode::OperationCode::newarray:
         case AeroJet::Java::ByteCode::OperationCode::ret:
-            AeroJet::Stream::Writer::write(dataStream, AeroJet::Stream::Reader::read<u1>(stream, byteOrder));
+            operandsSize = 1;
             break;
         case AeroJet::Java::ByteCode::OperationCode::anewarray:
         case AeroJet::Java::ByteCode::OperationCode::checkcast:
@@ -261,15 +277,12 @@ AeroJet::Java::ByteCode::Instruction AeroJet::Stream::Reader::read(std::istream&
         case AeroJet::Java::ByteCode::OperationCode::putstatic:
         case AeroJet::Java::ByteCode::OperationCode::sipush:
         {
-            AeroJet::Stream::Writer::write(dataStream, AeroJet::Stream::Reader::read<u1>(stream, byteOrder));
-            AeroJet::Stream::Writer::write(dataStream, AeroJet::Stream::Reader::read<u1>(stream, byteOrder));
+            operandsSize = 2;
             break;
         }
         case AeroJet::Java::ByteCode::OperationCode::multianewarray:
         {
-            AeroJet::Stream::Writer::write(dataStream, AeroJet::Stream::Reader::read<u1>(stream, byteOrder));
-            AeroJet::Stream::Writer::write(dataStream, AeroJet::Stream::Reader::read<u1>(stream, byteOrder));
-            AeroJet::Stream::Writer::write(dataStream, AeroJet::Stream::Reader::read<u1>(stream, byteOrder));
+            operandsSize = 3;
             break;
         }
         case AeroJet::Java::ByteCode::OperationCode::goto_w:
@@ -277,16 +290,13 @@ AeroJet::Java::ByteCode::Instruction AeroJet::Stream::Reader::read(std::istream&
         case AeroJet::Java::ByteCode::OperationCode::invokeinterface:
         case AeroJet::Java::ByteCode::OperationCode::jsr_w:
         {
-            AeroJet::Stream::Writer::write(dataStream, AeroJet::Stream::Reader::read<AeroJet::u1>(stream, byteOrder));
-            AeroJet::Stream::Writer::write(dataStream, AeroJet::Stream::Reader::read<AeroJet::u1>(stream, byteOrder));
-            AeroJet::Stream::Writer::write(dataStream, AeroJet::Stream::Reader::read<AeroJet::u1>(stream, byteOrder));
-            AeroJet::Stream::Writer::write(dataStream, AeroJet::Stream::Reader::read<AeroJet::u1>(stream, byteOrder));
+            operandsSize = 4;
             break;
         }
         case AeroJet::Java::ByteCode::OperationCode::tableswitch:
         case AeroJet::Java::ByteCode::OperationCode::lookupswitch:
         {
-            const i4 localOffset = (static_cast<i4>(stream.tellg()) - 9);
+            const i4 localOffset = (static_cast<i4>(cursor.position()) - 9);
 
             /*
              * JVM specification: A tableswitch/lookupswitch is a variable-length instruction.
@@ -296,67 +306,72 @@ AeroJet::Java::ByteCode::Instruction AeroJet::Stream::Reader::read(std::istream&
              * that is a multiple of four bytes from the start of the current method
              * (the opcode of its first instruction).
              */
+            const u4 padding = (((localOffset + 1) + 3) & ~3) - localOffset;
+            if(!cursor.canRead(padding - 1 + sizeof(AeroJet::i4)))
             {
-                const u4 padding = (((localOffset + 1) + 3) & ~3) - localOffset;
-                u4 paddingIndex = padding;
-                while((paddingIndex - 1) > 0)
-                {
-                    AeroJet::Stream::Reader::read<u1>(stream, byteOrder);
-                    paddingIndex--;
-                }
+                return readError(ReadErrorCode::UNEXPECTED_END, cursor.position());
+            }
+
+            cursor.skip(padding - 1);
+
+            const AeroJet::i4 defaultValue = localOffset + cursor.readUnchecked<AeroJet::i4>();
+            data.write(defaultValue);
+
+            if(!cursor.canRead(opCode == AeroJet::Java::ByteCode::OperationCode::tableswitch ? sizeof(AeroJet::i4) * 2 : sizeof(AeroJet::i4)))
+            {
+                return readError(ReadErrorCode::UNEXPECTED_END, cursor.position());
             }
 
             if(opCode == AeroJet::Java::ByteCode::OperationCode::tableswitch)
             {
-                const AeroJet::i4 defaultValue =
-                    localOffset + AeroJet::Stream::Reader::read<AeroJet::i4>(stream, byteOrder);
-                const AeroJet::i4 lowValue = AeroJet::Stream::Reader::read<AeroJet::i4>(stream, byteOrder);
-                const AeroJet::i4 highValue = AeroJet::Stream::Reader::read<AeroJet::i4>(stream, byteOrder);
+                const AeroJet::i4 lowValue = cursor.readUnchecked<AeroJet::i4>();
+                const AeroJet::i4 highValue = cursor.readUnchecked<AeroJet::i4>();
 
-                AeroJet::Stream::Writer::write(dataStream, defaultValue, AeroJet::Stream::ByteOrder::INVERSE);
-                AeroJet::Stream::Writer::write(dataStream, lowValue, AeroJet::Stream::ByteOrder::INVERSE);
-                AeroJet::Stream::Writer::write(dataStream, highValue, AeroJet::Stream::ByteOrder::INVERSE);
+                data.write(lowValue);
+                data.write(highValue);
 
-                const AeroJet::i4 jumpOffsetsCount = highValue - lowValue + 1;
-                for(size_t jumpOffsetIndex = 0; jumpOffsetIndex < jumpOffsetsCount; jumpOffsetIndex++)
+                const AeroJet::i8 jumpOffsetsCount = static_cast<AeroJet::i8>(highValue) - lowValue + 1;
+                if(jumpOffsetsCount < 0)
                 {
-                    AeroJet::Stream::Writer::write(dataStream,
-                                                   localOffset +
-                                                       AeroJet::Stream::Reader::read<AeroJet::i4>(stream, byteOrder),
-                                                   AeroJet::Stream::ByteOrder::INVERSE);
+                    return readError(ReadErrorCode::INVALID_SWITCH, opCodePosition);
                 }
 
-                break;
-            }
+                if(!cursor.canRead(static_cast<std::size_t>(jumpOffsetsCount) * sizeof(AeroJet::i4)))
+                {
+                    return readError(ReadErrorCode::UNEXPECTED_END, cursor.position());
+                }
 
-            if(opCode == AeroJet::Java::ByteCode::OperationCode::lookupswitch)
+                for(AeroJet::i8 jumpOffsetIndex = 0; jumpOffsetIndex < jumpOffsetsCount; jumpOffsetIndex++)
+                {
+                    data.write(static_cast<AeroJet::i4>(localOffset + cursor.readUnchecked<AeroJet::i4>()));
+                }
+            }
+            else
             {
-                const AeroJet::i4 defaultValue =
-                    localOffset + AeroJet::Stream::Reader::read<AeroJet::i4>(stream, byteOrder);
-                AeroJet::Stream::Writer::write(dataStream, defaultValue, AeroJet::Stream::ByteOrder::INVERSE);
-
-                const AeroJet::i4 npairsCount = AeroJet::Stream::Reader::read<AeroJet::i4>(stream, byteOrder);
-                AeroJet::Stream::Writer::write(dataStream, npairsCount, AeroJet::Stream::ByteOrder::INVERSE);
+                const AeroJet::i4 npairsCount = cursor.readUnchecked<AeroJet::i4>();
+                data.write(npairsCount);
 
-                for(AeroJet::i4 npairIndex = 0; npairIndex < npairsCount; npairIndex++)
+                if(npairsCount < 0)
                 {
-                    AeroJet::Stream::Writer::write(dataStream,
-                                                   AeroJet::Stream::Reader::read<AeroJet::i4>(stream, byteOrder),
-                                                   AeroJet::Stream::ByteOrder::INVERSE);
-                    AeroJet::Stream::Writer::write(dataStream,
-                                                   AeroJet::Stream::Reader::read<AeroJet::i4>(stream, byteOrder),
-                                                   AeroJet::Stream::ByteOrder::INVERSE);
+                    return readError(ReadErrorCode::INVALID_SWITCH, opCodePosition);
                 }
 
-                break;
+                // match-offset pairs are kept as is, both are already big-endian
+                operandsSize = static_cast<std::size_t>(npairsCount) * sizeof(AeroJet::i4) * 2;
             }
+
+            break;
         }
         case AeroJet::Java::ByteCode::OperationCode::wide:
         {
+            if(!cursor.canRead(sizeof(AeroJet::u1)))
+            {
+                return readError(ReadErrorCode::UNEXPECTED_END, cursor.position());
+            }
+
             const AeroJet::Java::ByteCode::OperationCode nextOpCode =
-                static_cast<AeroJet::Java::ByteCode::OperationCode>(
-                    AeroJet::Stream::Reader::read<AeroJet::u1>(stream, byteOrder));
-            AeroJet::Stream::Writer::write(dataStream, static_cast<AeroJet::u1>(nextOpCode));
+                static_cast<AeroJet::Java::ByteCode::OperationCode>(cursor.readUnchecked<AeroJet::u1>());
+            data.write(static_cast<AeroJet::u1>(nextOpCode));
 
             switch(nextOpCode)
             {
@@ -372,34 +387,62 @@ AeroJet::Java::ByteCode::Instruction AeroJet::Stream::Reader::read(std::istream&
                 case AeroJet::Java::ByteCode::OperationCode::dstore:
                 case AeroJet::Java::ByteCode::OperationCode::ret:
                 {
-                    AeroJet::Stream::Writer::write(dataStream,
-                                                   AeroJet::Stream::Reader::read<AeroJet::u1>(stream, byteOrder));
-                    AeroJet::Stream::Writer::write(dataStream,
-                                                   AeroJet::Stream::Reader::read<AeroJet::u1>(stream, byteOrder));
+                    operandsSize = 2;
                     break;
                 }
                 case AeroJet::Java::ByteCode::OperationCode::iinc:
                 {
-                    AeroJet::Stream::Writer::write(dataStream,
-                                                   AeroJet::Stream::Reader::read<AeroJet::u1>(stream, byteOrder));
-                    AeroJet::Stream::Writer::write(dataStream,
-                                                   AeroJet::Stream::Reader::read<AeroJet::u1>(stream, byteOrder));
-                    AeroJet::Stream::Writer::write(dataStream,
-                                                   AeroJet::Stream::Reader::read<AeroJet::u1>(stream, byteOrder));
-                    AeroJet::Stream::Writer::write(dataStream,
-                                                   AeroJet::Stream::Reader::read<AeroJet::u1>(stream, byteOrder));
+                    operandsSize = 4;
                     break;
                 }
                 default:
-                    throw AeroJet::Exceptions::RuntimeException(
-                        fmt::format("Unexpected OpCode ({:#04x}) after 'wide'!", static_cast<AeroJet::u1>(nextOpCode)));
+                    return readError(ReadErrorCode::UNEXPECTED_WIDE_OPCODE, opCodePosition + 1);
             }
             break;
         }
         default:
-            throw AeroJet::Exceptions::OperationNotSupportedException(opCode);
+            return readError(ReadErrorCode::UNKNOWN_OPCODE, opCodePosition);
+    }
+
+    if(!cursor.canRead(operandsSize))
+    {
+        return readError(ReadErrorCode::UNEXPECTED_END, cursor.position());
+    }
+
+    data.append(cursor.readBytes(operandsSize));
+
+    return AeroJet::Java::ByteCode::Instruction{ opCode, data.bytes(), memoryResource };
+}
+
+template<>
+AeroJet::Stream::ReadResult<AeroJet::Java::ByteCode::Instruction> AeroJet::Stream::Reader::tryRead(ByteCursor& cursor)
+{
+    ByteBuffer operands;
+    return AeroJet::Java::ByteCode::Instruction::tryRead(cursor, operands);
+}
+
+AeroJet::Java::ByteCode::Instruction AeroJet::Java::ByteCode::Instruction::read(Stream::ByteCursor& cursor,
+                                                                                Stream::ByteBuffer& operands,
+                                                                                std::pmr::memory_resource* memoryResource)
+{
+    Stream::ReadResult<Instruction> instruction = tryRead(cursor, operands, memoryResource);
+    if(!instruction && instruction.error().code == Stream::ReadErrorCode::UNKNOWN_OPCODE)
+    {
+        throw Exceptions::OperationNotSupportedException(static_cast<OperationCode>(cursor.bytes()[instruction.error().offset]));
     }
 
-    std::vector<AeroJet::u1> dataBytes = AeroJet::Stream::Utils::streamToBytes(dataStream);
-    return { opCode, std::move(dataBytes) };
+    return Stream::Reader::valueOrThrow(std::move(instruction));
+}
+
+template<>
+AeroJet::Java::ByteCode::Instruction AeroJet::Stream::Reader::read(ByteCursor& cursor)
+{
+    ByteBuffer operands;
+    return AeroJet::Java::ByteCode::Instruction::read(cursor, operands);
+}
+
+template<>
+AeroJet::Java::ByteCode::Instruction AeroJet::Stream::Reader::read(std::istream& stream, ByteOrder /*byteOrder*/)
+{
+    return AeroJet::Stream::Reader::readBuffered<AeroJet::Java::ByteCode::Instruction>(stream);
 }
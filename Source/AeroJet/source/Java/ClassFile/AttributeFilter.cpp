@@ -0,0 +1,144 @@
+/*
+ * AttributeFilter.cpp
+ *
+ * Copyright © 2024 AeroJet Developers. All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the “Software”), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+ * OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "Java/ClassFile/AttributeFilter.hpp"
+
+#include "Stream/Reader.hpp"
+
+#include <algorithm>
+
+namespace AeroJet::Java::ClassFile
+{
+    AttributeFilter::AttributeFilter(std::initializer_list<std::string_view> names) :
+        AttributeFilter(std::vector<std::string_view>{ names })
+    {
+    }
+
+    AttributeFilter::AttributeFilter(const std::vector<std::string_view>& names) :
+        m_keepsAll(false)
+    {
+        m_names.reserve(names.size());
+        for(const std::string_view name : names)
+        {
+            m_names.emplace_back(SymbolTable::global().intern(name).id);
+        }
+
+        std::sort(m_names.begin(), m_names.end());
+        m_names.erase(std::unique(m_names.begin(), m_names.end()), m_names.end());
+    }
+
+    const AttributeFilter& AttributeFilter::all()
+    {
+        static const AttributeFilter filter;
+        return filter;
+    }
+
+    const AttributeFilter& AttributeFilter::none()
+    {
+        static const AttributeFilter filter{ std::vector<std::string_view>{} };
+        return filter;
+    }
+
+    bool AttributeFilter::keepsAll() const
+    {
+        return m_keepsAll;
+    }
+
+    bool AttributeFilter::keeps(SymbolId name) const
+    {
+        return m_keepsAll || std::binary_search(m_names.begin(), m_names.end(), name);
+    }
+
+    bool AttributeFilter::keeps(std::string_view name) const
+    {
+        if(m_keepsAll)
+        {
+            return true;
+        }
+
+        const std::optional<SymbolId> symbol = SymbolTable::global().find(name);
+        return symbol.has_value() && keeps(symbol.value());
+    }
+
+    bool AttributeFilter::keeps(const ConstantPool& constantPool, u2 nameIndex) const
+    {
+        if(m_keepsAll)
+        {
+            return true;
+        }
+
+        if(!constantPool.contains(nameIndex) || constantPool.at(nameIndex).tag() != ConstantPoolInfoTag::UTF_8)
+        {
+            return false;
+        }
+
+        return keeps(constantPool.symbol(nameIndex));
+    }
+
+    Stream::ReadResult<std::pmr::vector<AttributeInfo>> AttributeFilter::tryRead(Stream::ByteCursor& cursor,
+                                                                                  u2 attributesCount,
+                                                                                  AttributeKindResolver* resolver,
+                                                                                  std::pmr::memory_resource* memoryResource) const
+    {
+        std::pmr::vector<AttributeInfo> attributes{ memoryResource };
+        if(m_keepsAll)
+        {
+            attributes.reserve(attributesCount);
+        }
+
+        for(int32_t attributeIndex = 0; attributeIndex < attributesCount; attributeIndex++)
+        {
+            if(!cursor.canRead(sizeof(u2) + sizeof(u4)))
+            {
+                return Stream::readError(Stream::ReadErrorCode::UNEXPECTED_END, cursor.position());
+            }
+
+            const u2 attributeNameIndex = cursor.readUnchecked<u2>();
+            const u4 attributeInfoSize = cursor.readUnchecked<u4>();
+            if(!cursor.canRead(attributeInfoSize))
+            {
+                return Stream::readError(Stream::ReadErrorCode::UNEXPECTED_END, cursor.position());
+            }
+
+            if(!m_keepsAll && (resolver == nullptr || !keeps(resolver->constantPool(), attributeNameIndex)))
+            {
+                cursor.skip(attributeInfoSize);
+                continue;
+            }
+
+            const AttributeKind kind = resolver != nullptr ? resolver->resolve(attributeNameIndex) : AttributeKind::UNKNOWN;
+            const std::span<const u1> attributeInfo = cursor.readBytes(attributeInfoSize);
+            if(cursor.owner())
+            {
+                attributes.emplace_back(attributeNameIndex, attributeInfo, cursor.owner(), kind);
+            }
+            else
+            {
+                attributes.emplace_back(attributeNameIndex, attributeInfo, memoryResource, kind);
+            }
+        }
+
+        return attributes;
+    }
+} // namespace AeroJet::Java::ClassFile
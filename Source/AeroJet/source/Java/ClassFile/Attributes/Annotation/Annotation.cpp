@@ -26,10 +26,17 @@
 
 #include "Stream/Reader.hpp"
 
+#include <utility>
+
 namespace AeroJet::Java::ClassFile
 {
     Annotation::Annotation(u2 typeIndex, const std::vector<ElementValuePair>& elementValuePairs) :
-        m_typeIndex(typeIndex), m_elementValuePairs(elementValuePairs)
+        m_typeIndex(typeIndex), m_elementValuePairs(elementValuePairs.begin(), elementValuePairs.end())
+    {
+    }
+
+    Annotation::Annotation(u2 typeIndex, std::pmr::vector<ElementValuePair> elementValuePairs) :
+        m_typeIndex(typeIndex), m_elementValuePairs(std::move(elementValuePairs))
     {
     }
 
@@ -43,29 +50,36 @@ namespace AeroJet::Java::ClassFile
         return m_elementValuePairs.size();
     }
 
-    const std::vector<ElementValuePair>& Annotation::elementValuePairs() const
+    AeroJet::Utils::TableView<ElementValuePair> Annotation::elementValuePairs() const
     {
         return m_elementValuePairs;
     }
 } // namespace AeroJet::Java::ClassFile
 
-template<>
-AeroJet::Java::ClassFile::Annotation AeroJet::Stream::Reader::read(std::istream& stream, ByteOrder byteOrder)
+AeroJet::Java::ClassFile::Annotation AeroJet::Java::ClassFile::Annotation::read(Stream::ByteCursor& cursor,
+                                                                                std::pmr::memory_resource* memoryResource)
 {
-    const u2 typeIndex = AeroJet::Stream::Reader::read<u2>(stream, byteOrder);
+    const u2 typeIndex = AeroJet::Stream::Reader::read<u2>(cursor);
 
-    const u2 numElementValuePairs = AeroJet::Stream::Reader::read<u2>(stream, byteOrder);
-    std::vector<AeroJet::Java::ClassFile::ElementValuePair> elementValues;
+    const u2 numElementValuePairs = AeroJet::Stream::Reader::read<u2>(cursor);
+    std::pmr::vector<AeroJet::Java::ClassFile::ElementValuePair> elementValues{ memoryResource };
     elementValues.reserve(numElementValuePairs);
     for(u2 elementValueIndex = 0; elementValueIndex < numElementValuePairs; elementValueIndex++)
     {
-        const u2 elementNameIndex = AeroJet::Stream::Reader::read<u2>(stream, byteOrder);
-        const Java::ClassFile::ElementValue elementValue =
-            AeroJet::Stream::Reader::read<Java::ClassFile::ElementValue>(stream, byteOrder);
-
-        AeroJet::Java::ClassFile::ElementValuePair elementValuePair{ elementNameIndex, elementValue };
-        elementValues.emplace_back(elementValuePair);
+        elementValues.emplace_back(AeroJet::Java::ClassFile::ElementValuePair::read(cursor, memoryResource));
     }
 
-    return AeroJet::Java::ClassFile::Annotation{ typeIndex, elementValues };
+    return AeroJet::Java::ClassFile::Annotation{ typeIndex, std::move(elementValues) };
+}
+
+template<>
+AeroJet::Java::ClassFile::Annotation AeroJet::Stream::Reader::read(ByteCursor& cursor)
+{
+    return AeroJet::Java::ClassFile::Annotation::read(cursor, std::pmr::get_default_resource());
+}
+
+template<>
+AeroJet::Java::ClassFile::Annotation AeroJet::Stream::Reader::read(std::istream& stream, ByteOrder /*byteOrder*/)
+{
+    return AeroJet::Stream::Reader::readBuffered<AeroJet::Java::ClassFile::Annotation>(stream);
 }
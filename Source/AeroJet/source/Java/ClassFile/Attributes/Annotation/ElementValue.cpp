@@ -49,14 +49,17 @@ namespace AeroJet::Java::ClassFile
     }
 
     ElementValue::ArrayValue::ArrayValue(const std::vector<ElementValue>& values) :
-        m_values(values) {}
+        m_values(values.begin(), values.end()) {}
+
+    ElementValue::ArrayValue::ArrayValue(std::pmr::vector<ElementValue> values) :
+        m_values(std::move(values)) {}
 
     u2 ElementValue::ArrayValue::numValues() const
     {
         return m_values.size();
     }
 
-    const std::vector<ElementValue>& ElementValue::ArrayValue::values() const
+    AeroJet::Utils::TableView<ElementValue> ElementValue::ArrayValue::values() const
     {
         return m_values;
     }
@@ -77,11 +80,11 @@ namespace AeroJet::Java::ClassFile
     }
 } // namespace AeroJet::Java::ClassFile
 
-template<>
-AeroJet::Java::ClassFile::ElementValue AeroJet::Stream::Reader::read(std::istream& stream, ByteOrder byteOrder)
+AeroJet::Java::ClassFile::ElementValue AeroJet::Java::ClassFile::ElementValue::read(Stream::ByteCursor& cursor,
+                                                                                    std::pmr::memory_resource* memoryResource)
 {
     const Java::ClassFile::ElementValue::Tag tag =
-        static_cast<Java::ClassFile::ElementValue::Tag>(AeroJet::Stream::Reader::read<u1>(stream, byteOrder));
+        static_cast<Java::ClassFile::ElementValue::Tag>(AeroJet::Stream::Reader::read<u1>(cursor));
 
     switch(tag)
     {
@@ -95,13 +98,13 @@ AeroJet::Java::ClassFile::ElementValue AeroJet::Stream::Reader::read(std::istrea
         case Java::ClassFile::ElementValue::Tag::BOOLEAN:
         case Java::ClassFile::ElementValue::Tag::STRING:
         {
-            const u2 constValueIndex = AeroJet::Stream::Reader::read<u2>(stream, byteOrder);
+            const u2 constValueIndex = AeroJet::Stream::Reader::read<u2>(cursor);
             return AeroJet::Java::ClassFile::ElementValue{ tag, AeroJet::u2{ constValueIndex } };
         }
         case Java::ClassFile::ElementValue::Tag::ENUM_TYPE:
         {
-            const u2 typeNameIndex = AeroJet::Stream::Reader::read<u2>(stream, byteOrder);
-            const u2 constValueIndex = AeroJet::Stream::Reader::read<u2>(stream, byteOrder);
+            const u2 typeNameIndex = AeroJet::Stream::Reader::read<u2>(cursor);
+            const u2 constValueIndex = AeroJet::Stream::Reader::read<u2>(cursor);
 
             return AeroJet::Java::ClassFile::ElementValue{
                 tag,
@@ -110,35 +113,47 @@ AeroJet::Java::ClassFile::ElementValue AeroJet::Stream::Reader::read(std::istrea
         }
         case Java::ClassFile::ElementValue::Tag::CLASS:
         {
-            const u2 classInfoIndex = AeroJet::Stream::Reader::read<u2>(stream, byteOrder);
+            const u2 classInfoIndex = AeroJet::Stream::Reader::read<u2>(cursor);
             return AeroJet::Java::ClassFile::ElementValue{ tag, AeroJet::u2{ classInfoIndex } };
         }
         case Java::ClassFile::ElementValue::Tag::ANNOTATION_TYPE:
         {
-            const AeroJet::Java::ClassFile::Annotation annotation =
-                AeroJet::Stream::Reader::read<AeroJet::Java::ClassFile::Annotation>(stream, byteOrder);
+            AeroJet::Java::ClassFile::Annotation annotation =
+                AeroJet::Java::ClassFile::Annotation::read(cursor, memoryResource);
 
             return AeroJet::Java::ClassFile::ElementValue{ tag,
-                                                           std::make_shared<AeroJet::Java::ClassFile::Annotation>(
-                                                               annotation) };
+                                                           std::allocate_shared<AeroJet::Java::ClassFile::Annotation>(
+                                                               std::pmr::polymorphic_allocator<AeroJet::Java::ClassFile::Annotation>{ memoryResource },
+                                                               std::move(annotation)) };
         }
         case Java::ClassFile::ElementValue::Tag::ARRAY_TYPE:
         {
-            const u2 numValues = AeroJet::Stream::Reader::read<u2>(stream, byteOrder);
+            const u2 numValues = AeroJet::Stream::Reader::read<u2>(cursor);
 
-            std::vector<AeroJet::Java::ClassFile::ElementValue> values;
+            std::pmr::vector<AeroJet::Java::ClassFile::ElementValue> values{ memoryResource };
             values.reserve(numValues);
             for(u2 valueIndex = 0; valueIndex < numValues; valueIndex++)
             {
-                values.emplace_back(
-                    AeroJet::Stream::Reader::read<AeroJet::Java::ClassFile::ElementValue>(stream, byteOrder));
+                values.emplace_back(read(cursor, memoryResource));
             }
 
             return AeroJet::Java::ClassFile::ElementValue{ tag,
                                                            AeroJet::Java::ClassFile::ElementValue::ArrayValue{
-                                                               values } };
+                                                               std::move(values) } };
         }
         default:
             throw Exceptions::RuntimeException(fmt::format("Unknown ElementValue tag: {}", static_cast<u1>(tag)));
     }
 }
+
+template<>
+AeroJet::Java::ClassFile::ElementValue AeroJet::Stream::Reader::read(ByteCursor& cursor)
+{
+    return AeroJet::Java::ClassFile::ElementValue::read(cursor, std::pmr::get_default_resource());
+}
+
+template<>
+AeroJet::Java::ClassFile::ElementValue AeroJet::Stream::Reader::read(std::istream& stream, ByteOrder /*byteOrder*/)
+{
+    return AeroJet::Stream::Reader::readBuffered<AeroJet::Java::ClassFile::ElementValue>(stream);
+}
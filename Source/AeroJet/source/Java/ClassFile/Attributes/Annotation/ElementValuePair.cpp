@@ -24,10 +24,14 @@
 
 #include "Java/ClassFile/Attributes/Annotation/ElementValuePair.hpp"
 
+#include "Stream/Reader.hpp"
+
+#include <utility>
+
 namespace AeroJet::Java::ClassFile
 {
-    ElementValuePair::ElementValuePair(u2 elementNameIndex, const ElementValue& value) :
-        m_elementNameIndex(elementNameIndex), m_value(value)
+    ElementValuePair::ElementValuePair(u2 elementNameIndex, ElementValue value) :
+        m_elementNameIndex(elementNameIndex), m_value(std::move(value))
     {
     }
 
@@ -40,4 +44,18 @@ namespace AeroJet::Java::ClassFile
     {
         return m_value;
     }
-} // namespace AeroJet::Java::ClassFile
\ No newline at end of file
+} // namespace AeroJet::Java::ClassFile
+AeroJet::Java::ClassFile::ElementValuePair AeroJet::Java::ClassFile::ElementValuePair::read(Stream::ByteCursor& cursor,
+                                                                                            std::pmr::memory_resource* memoryResource)
+{
+    const u2 elementNameIndex = AeroJet::Stream::Reader::read<u2>(cursor);
+    Java::ClassFile::ElementValue elementValue = Java::ClassFile::ElementValue::read(cursor, memoryResource);
+
+    return AeroJet::Java::ClassFile::ElementValuePair{ elementNameIndex, std::move(elementValue) };
+}
+
+template<>
+AeroJet::Java::ClassFile::ElementValuePair AeroJet::Stream::Reader::read(ByteCursor& cursor)
+{
+    return AeroJet::Java::ClassFile::ElementValuePair::read(cursor, std::pmr::get_default_resource());
+}
@@ -26,34 +26,50 @@
 
 #include "Stream/Reader.hpp"
 
+#include <utility>
+
 namespace AeroJet::Java::ClassFile
 {
     ParameterAnnotation::ParameterAnnotation(const std::vector<Annotation>& annotations) :
-        m_annotations(annotations) {}
+        m_annotations(annotations.begin(), annotations.end()) {}
+
+    ParameterAnnotation::ParameterAnnotation(std::pmr::vector<Annotation> annotations) :
+        m_annotations(std::move(annotations)) {}
 
     u2 ParameterAnnotation::numAnnotations() const
     {
         return m_annotations.size();
     }
-    const std::vector<Annotation>& ParameterAnnotation::annotations() const
+    AeroJet::Utils::TableView<Annotation> ParameterAnnotation::annotations() const
     {
         return m_annotations;
     }
 } // namespace AeroJet::Java::ClassFile
 
-template<>
-AeroJet::Java::ClassFile::ParameterAnnotation AeroJet::Stream::Reader::read(std::istream& stream, ByteOrder byteOrder)
+AeroJet::Java::ClassFile::ParameterAnnotation AeroJet::Java::ClassFile::ParameterAnnotation::read(Stream::ByteCursor& cursor,
+                                                                                                  std::pmr::memory_resource* memoryResource)
 {
-    std::vector<AeroJet::Java::ClassFile::Annotation> annotations;
+    std::pmr::vector<AeroJet::Java::ClassFile::Annotation> annotations{ memoryResource };
 
-    const u2 numAnnotations = AeroJet::Stream::Reader::read<u2>(stream, byteOrder);
+    const u2 numAnnotations = AeroJet::Stream::Reader::read<u2>(cursor);
     annotations.reserve(numAnnotations);
 
     for(u2 annotationIndex = 0; annotationIndex < numAnnotations; annotationIndex++)
     {
-        annotations.emplace_back(
-            AeroJet::Stream::Reader::read<AeroJet::Java::ClassFile::Annotation>(stream, byteOrder));
+        annotations.emplace_back(AeroJet::Java::ClassFile::Annotation::read(cursor, memoryResource));
     }
 
-    return AeroJet::Java::ClassFile::ParameterAnnotation{ annotations };
+    return AeroJet::Java::ClassFile::ParameterAnnotation{ std::move(annotations) };
+}
+
+template<>
+AeroJet::Java::ClassFile::ParameterAnnotation AeroJet::Stream::Reader::read(ByteCursor& cursor)
+{
+    return AeroJet::Java::ClassFile::ParameterAnnotation::read(cursor, std::pmr::get_default_resource());
+}
+
+template<>
+AeroJet::Java::ClassFile::ParameterAnnotation AeroJet::Stream::Reader::read(std::istream& stream, ByteOrder /*byteOrder*/)
+{
+    return AeroJet::Stream::Reader::readBuffered<AeroJet::Java::ClassFile::ParameterAnnotation>(stream);
 }
@@ -102,6 +102,9 @@ namespace AeroJet::Java::ClassFile
     }
 
     LocalVarTarget::LocalVarTarget(std::vector<TableEntry> table) :
+        m_table(table.begin(), table.end()) {}
+
+    LocalVarTarget::LocalVarTarget(std::pmr::vector<TableEntry> table) :
         m_table(std::move(table)) {}
 
     u2 LocalVarTarget::tableLength() const
@@ -109,7 +112,7 @@ namespace AeroJet::Java::ClassFile
         return m_table.size();
     }
 
-    const std::vector<LocalVarTarget::TableEntry>& LocalVarTarget::table() const
+    AeroJet::Utils::TableView<LocalVarTarget::TableEntry> LocalVarTarget::table() const
     {
         return m_table;
     }
@@ -161,6 +164,9 @@ namespace AeroJet::Java::ClassFile
     }
 
     TypePath::TypePath(std::vector<Path> path) :
+        m_path(path.begin(), path.end()) {}
+
+    TypePath::TypePath(std::pmr::vector<Path> path) :
         m_path(std::move(path)) {}
 
     u1 TypePath::pathLength() const
@@ -168,7 +174,7 @@ namespace AeroJet::Java::ClassFile
         return m_path.size();
     }
 
-    const std::vector<TypePath::Path>& TypePath::path() const
+    AeroJet::Utils::TableView<TypePath::Path> TypePath::path() const
     {
         return m_path;
     }
@@ -180,7 +186,18 @@ namespace AeroJet::Java::ClassFile
                                    const std::vector<ElementValuePair>& elementValuePairs) :
         m_targetType(targetType),
         m_targetInfo(std::move(targetInfo)), m_targetPath(std::move(targetPath)), m_typeIndex(typeIndex),
-        m_elementValuePairs(elementValuePairs)
+        m_elementValuePairs(elementValuePairs.begin(), elementValuePairs.end())
+    {
+    }
+
+    TypeAnnotation::TypeAnnotation(u1 targetType,
+                                   TargetInfo targetInfo,
+                                   TypePath targetPath,
+                                   u2 typeIndex,
+                                   std::pmr::vector<ElementValuePair> elementValuePairs) :
+        m_targetType(targetType),
+        m_targetInfo(std::move(targetInfo)), m_targetPath(std::move(targetPath)), m_typeIndex(typeIndex),
+        m_elementValuePairs(std::move(elementValuePairs))
     {
     }
     u1 TypeAnnotation::targetType() const
@@ -208,116 +225,187 @@ namespace AeroJet::Java::ClassFile
         return m_elementValuePairs.size();
     }
 
-    const std::vector<ElementValuePair>& TypeAnnotation::elementValuePairs() const
+    AeroJet::Utils::TableView<ElementValuePair> TypeAnnotation::elementValuePairs() const
     {
         return m_elementValuePairs;
     }
 } // namespace AeroJet::Java::ClassFile
 
 template<>
-AeroJet::Java::ClassFile::TypeParameterTarget AeroJet::Stream::Reader::read(std::istream& stream, ByteOrder byteOrder)
+AeroJet::Java::ClassFile::TypeParameterTarget AeroJet::Stream::Reader::read(ByteCursor& cursor)
 {
-    const u1 typeParameterIndex = AeroJet::Stream::Reader::read<u1>(stream, byteOrder);
+    const u1 typeParameterIndex = AeroJet::Stream::Reader::read<u1>(cursor);
     return AeroJet::Java::ClassFile::TypeParameterTarget{ typeParameterIndex };
 }
 
 template<>
-AeroJet::Java::ClassFile::SuperTypeTarget AeroJet::Stream::Reader::read(std::istream& stream, ByteOrder byteOrder)
+AeroJet::Java::ClassFile::TypeParameterTarget AeroJet::Stream::Reader::read(std::istream& stream, ByteOrder /*byteOrder*/)
+{
+    return AeroJet::Stream::Reader::readBuffered<AeroJet::Java::ClassFile::TypeParameterTarget>(stream);
+}
+
+template<>
+AeroJet::Java::ClassFile::SuperTypeTarget AeroJet::Stream::Reader::read(ByteCursor& cursor)
 {
-    const u2 superTypeIndex = AeroJet::Stream::Reader::read<u2>(stream, byteOrder);
+    const u2 superTypeIndex = AeroJet::Stream::Reader::read<u2>(cursor);
     return AeroJet::Java::ClassFile::SuperTypeTarget{ superTypeIndex };
 }
 
 template<>
-AeroJet::Java::ClassFile::TypeParameterBoundTarget AeroJet::Stream::Reader::read(std::istream& stream,
-                                                                                 ByteOrder byteOrder)
+AeroJet::Java::ClassFile::SuperTypeTarget AeroJet::Stream::Reader::read(std::istream& stream, ByteOrder /*byteOrder*/)
+{
+    return AeroJet::Stream::Reader::readBuffered<AeroJet::Java::ClassFile::SuperTypeTarget>(stream);
+}
+
+template<>
+AeroJet::Java::ClassFile::TypeParameterBoundTarget AeroJet::Stream::Reader::read(ByteCursor& cursor)
 {
-    const u1 typeParameterIndex = AeroJet::Stream::Reader::read<u1>(stream, byteOrder);
-    const u1 boundIndex = AeroJet::Stream::Reader::read<u1>(stream, byteOrder);
+    const u1 typeParameterIndex = AeroJet::Stream::Reader::read<u1>(cursor);
+    const u1 boundIndex = AeroJet::Stream::Reader::read<u1>(cursor);
 
     return AeroJet::Java::ClassFile::TypeParameterBoundTarget{ typeParameterIndex, boundIndex };
 }
 
 template<>
-AeroJet::Java::ClassFile::FormalParameterTarget AeroJet::Stream::Reader::read(std::istream& stream, ByteOrder byteOrder)
+AeroJet::Java::ClassFile::TypeParameterBoundTarget AeroJet::Stream::Reader::read(std::istream& stream, ByteOrder /*byteOrder*/)
+{
+    return AeroJet::Stream::Reader::readBuffered<AeroJet::Java::ClassFile::TypeParameterBoundTarget>(stream);
+}
+
+template<>
+AeroJet::Java::ClassFile::FormalParameterTarget AeroJet::Stream::Reader::read(ByteCursor& cursor)
 {
-    const u1 formalParameterIndex = AeroJet::Stream::Reader::read<u1>(stream, byteOrder);
+    const u1 formalParameterIndex = AeroJet::Stream::Reader::read<u1>(cursor);
     return AeroJet::Java::ClassFile::FormalParameterTarget{ formalParameterIndex };
 }
 
 template<>
-AeroJet::Java::ClassFile::ThrowsTarget AeroJet::Stream::Reader::read(std::istream& stream, ByteOrder byteOrder)
+AeroJet::Java::ClassFile::FormalParameterTarget AeroJet::Stream::Reader::read(std::istream& stream, ByteOrder /*byteOrder*/)
+{
+    return AeroJet::Stream::Reader::readBuffered<AeroJet::Java::ClassFile::FormalParameterTarget>(stream);
+}
+
+template<>
+AeroJet::Java::ClassFile::ThrowsTarget AeroJet::Stream::Reader::read(ByteCursor& cursor)
 {
-    const u2 throwsTypeIndex = AeroJet::Stream::Reader::read<u2>(stream, byteOrder);
+    const u2 throwsTypeIndex = AeroJet::Stream::Reader::read<u2>(cursor);
     return AeroJet::Java::ClassFile::ThrowsTarget{ throwsTypeIndex };
 }
 
 template<>
-AeroJet::Java::ClassFile::LocalVarTarget AeroJet::Stream::Reader::read(std::istream& stream, ByteOrder byteOrder)
+AeroJet::Java::ClassFile::ThrowsTarget AeroJet::Stream::Reader::read(std::istream& stream, ByteOrder /*byteOrder*/)
+{
+    return AeroJet::Stream::Reader::readBuffered<AeroJet::Java::ClassFile::ThrowsTarget>(stream);
+}
+
+AeroJet::Java::ClassFile::LocalVarTarget AeroJet::Java::ClassFile::LocalVarTarget::read(Stream::ByteCursor& cursor,
+                                                                                        std::pmr::memory_resource* memoryResource)
 {
-    const u2 tableLength = AeroJet::Stream::Reader::read<u2>(stream, byteOrder);
-    std::vector<AeroJet::Java::ClassFile::LocalVarTarget::TableEntry> table;
+    const u2 tableLength = AeroJet::Stream::Reader::read<u2>(cursor);
+    std::pmr::vector<AeroJet::Java::ClassFile::LocalVarTarget::TableEntry> table{ memoryResource };
     table.reserve(tableLength);
 
     for(u2 tableEntryIndex = 0; tableEntryIndex < tableLength; tableEntryIndex++)
     {
-        const u2 startPc = AeroJet::Stream::Reader::read<u2>(stream, byteOrder);
-        const u2 length = AeroJet::Stream::Reader::read<u2>(stream, byteOrder);
-        const u2 index = AeroJet::Stream::Reader::read<u2>(stream, byteOrder);
+        const u2 startPc = AeroJet::Stream::Reader::read<u2>(cursor);
+        const u2 length = AeroJet::Stream::Reader::read<u2>(cursor);
+        const u2 index = AeroJet::Stream::Reader::read<u2>(cursor);
 
         table.emplace_back(startPc, length, index);
     }
 
-    return AeroJet::Java::ClassFile::LocalVarTarget{ table };
+    return AeroJet::Java::ClassFile::LocalVarTarget{ std::move(table) };
+}
+
+template<>
+AeroJet::Java::ClassFile::LocalVarTarget AeroJet::Stream::Reader::read(ByteCursor& cursor)
+{
+    return AeroJet::Java::ClassFile::LocalVarTarget::read(cursor, std::pmr::get_default_resource());
+}
+
+template<>
+AeroJet::Java::ClassFile::LocalVarTarget AeroJet::Stream::Reader::read(std::istream& stream, ByteOrder /*byteOrder*/)
+{
+    return AeroJet::Stream::Reader::readBuffered<AeroJet::Java::ClassFile::LocalVarTarget>(stream);
 }
 
 template<>
-AeroJet::Java::ClassFile::CatchTarget AeroJet::Stream::Reader::read(std::istream& stream, ByteOrder byteOrder)
+AeroJet::Java::ClassFile::CatchTarget AeroJet::Stream::Reader::read(ByteCursor& cursor)
 {
-    const u2 exceptionTableIndex = AeroJet::Stream::Reader::read<u2>(stream, byteOrder);
+    const u2 exceptionTableIndex = AeroJet::Stream::Reader::read<u2>(cursor);
     return AeroJet::Java::ClassFile::CatchTarget{ exceptionTableIndex };
 }
 
 template<>
-AeroJet::Java::ClassFile::OffsetTarget AeroJet::Stream::Reader::read(std::istream& stream, ByteOrder byteOrder)
+AeroJet::Java::ClassFile::CatchTarget AeroJet::Stream::Reader::read(std::istream& stream, ByteOrder /*byteOrder*/)
+{
+    return AeroJet::Stream::Reader::readBuffered<AeroJet::Java::ClassFile::CatchTarget>(stream);
+}
+
+template<>
+AeroJet::Java::ClassFile::OffsetTarget AeroJet::Stream::Reader::read(ByteCursor& cursor)
 {
-    const u2 offset = AeroJet::Stream::Reader::read<u2>(stream, byteOrder);
+    const u2 offset = AeroJet::Stream::Reader::read<u2>(cursor);
     return AeroJet::Java::ClassFile::OffsetTarget{ offset };
 }
 
 template<>
-AeroJet::Java::ClassFile::TypeArgumentTarget AeroJet::Stream::Reader::read(std::istream& stream, ByteOrder byteOrder)
+AeroJet::Java::ClassFile::OffsetTarget AeroJet::Stream::Reader::read(std::istream& stream, ByteOrder /*byteOrder*/)
+{
+    return AeroJet::Stream::Reader::readBuffered<AeroJet::Java::ClassFile::OffsetTarget>(stream);
+}
+
+template<>
+AeroJet::Java::ClassFile::TypeArgumentTarget AeroJet::Stream::Reader::read(ByteCursor& cursor)
 {
-    const u2 offset = AeroJet::Stream::Reader::read<u2>(stream, byteOrder);
-    const u1 typeArgumentIndex = AeroJet::Stream::Reader::read<u1>(stream, byteOrder);
+    const u2 offset = AeroJet::Stream::Reader::read<u2>(cursor);
+    const u1 typeArgumentIndex = AeroJet::Stream::Reader::read<u1>(cursor);
 
     return AeroJet::Java::ClassFile::TypeArgumentTarget{ offset, typeArgumentIndex };
 }
 
 template<>
-AeroJet::Java::ClassFile::TypePath AeroJet::Stream::Reader::read(std::istream& stream, ByteOrder byteOrder)
+AeroJet::Java::ClassFile::TypeArgumentTarget AeroJet::Stream::Reader::read(std::istream& stream, ByteOrder /*byteOrder*/)
+{
+    return AeroJet::Stream::Reader::readBuffered<AeroJet::Java::ClassFile::TypeArgumentTarget>(stream);
+}
+
+AeroJet::Java::ClassFile::TypePath AeroJet::Java::ClassFile::TypePath::read(Stream::ByteCursor& cursor,
+                                                                            std::pmr::memory_resource* memoryResource)
 {
-    const u1 pathLength = AeroJet::Stream::Reader::read<u1>(stream, byteOrder);
+    const u1 pathLength = AeroJet::Stream::Reader::read<u1>(cursor);
 
-    std::vector<AeroJet::Java::ClassFile::TypePath::Path> paths;
+    std::pmr::vector<AeroJet::Java::ClassFile::TypePath::Path> paths{ memoryResource };
     paths.reserve(pathLength);
 
     for(u1 pathIndex = 0; pathIndex < pathLength; pathIndex++)
     {
-        const u1 typePathKind = AeroJet::Stream::Reader::read<u1>(stream, byteOrder);
-        const u1 typeArgumentIndex = AeroJet::Stream::Reader::read<u1>(stream, byteOrder);
+        const u1 typePathKind = AeroJet::Stream::Reader::read<u1>(cursor);
+        const u1 typeArgumentIndex = AeroJet::Stream::Reader::read<u1>(cursor);
 
         paths.emplace_back(static_cast<AeroJet::Java::ClassFile::TypePath::TypePathKind>(typePathKind),
                            typeArgumentIndex);
     }
 
-    return AeroJet::Java::ClassFile::TypePath{ paths };
+    return AeroJet::Java::ClassFile::TypePath{ std::move(paths) };
+}
+
+template<>
+AeroJet::Java::ClassFile::TypePath AeroJet::Stream::Reader::read(ByteCursor& cursor)
+{
+    return AeroJet::Java::ClassFile::TypePath::read(cursor, std::pmr::get_default_resource());
 }
 
 template<>
-AeroJet::Java::ClassFile::TypeAnnotation AeroJet::Stream::Reader::read(std::istream& stream, ByteOrder byteOrder)
+AeroJet::Java::ClassFile::TypePath AeroJet::Stream::Reader::read(std::istream& stream, ByteOrder /*byteOrder*/)
+{
+    return AeroJet::Stream::Reader::readBuffered<AeroJet::Java::ClassFile::TypePath>(stream);
+}
+
+AeroJet::Java::ClassFile::TypeAnnotation AeroJet::Java::ClassFile::TypeAnnotation::read(Stream::ByteCursor& cursor,
+                                                                                        std::pmr::memory_resource* memoryResource)
 {
-    const u1 targetType = AeroJet::Stream::Reader::read<u1>(stream, byteOrder);
+    const u1 targetType = AeroJet::Stream::Reader::read<u1>(cursor);
 
     Java::ClassFile::TargetInfo targetInfo{ Java::ClassFile::EmptyTarget{} };
     switch(targetType)
@@ -326,19 +414,19 @@ AeroJet::Java::ClassFile::TypeAnnotation AeroJet::Stream::Reader::read(std::istr
         case 0x01: // type parameter declaration of generic method or constructor
         {
             targetInfo =
-                AeroJet::Stream::Reader::read<AeroJet::Java::ClassFile::TypeParameterTarget>(stream, byteOrder);
+                AeroJet::Stream::Reader::read<AeroJet::Java::ClassFile::TypeParameterTarget>(cursor);
             break;
         }
         case 0x10: // type in extends or implements clause of class declaration
         {
-            targetInfo = AeroJet::Stream::Reader::read<AeroJet::Java::ClassFile::SuperTypeTarget>(stream, byteOrder);
+            targetInfo = AeroJet::Stream::Reader::read<AeroJet::Java::ClassFile::SuperTypeTarget>(cursor);
             break;
         }
         case 0x11: // type in bound of type parameter declaration of generic class or interface
         case 0x12: // type in bound of type parameter declaration of generic method or constructor
         {
             targetInfo =
-                AeroJet::Stream::Reader::read<AeroJet::Java::ClassFile::TypeParameterBoundTarget>(stream, byteOrder);
+                AeroJet::Stream::Reader::read<AeroJet::Java::ClassFile::TypeParameterBoundTarget>(cursor);
             break;
         }
         case 0x13: // type in field declaration
@@ -351,23 +439,23 @@ AeroJet::Java::ClassFile::TypeAnnotation AeroJet::Stream::Reader::read(std::istr
         case 0x16: // type in formal parameter declaration of method, constructor, or lambda expression
         {
             targetInfo =
-                AeroJet::Stream::Reader::read<AeroJet::Java::ClassFile::FormalParameterTarget>(stream, byteOrder);
+                AeroJet::Stream::Reader::read<AeroJet::Java::ClassFile::FormalParameterTarget>(cursor);
             break;
         }
         case 0x17: // type in throws clause of method or constructor
         {
-            targetInfo = AeroJet::Stream::Reader::read<AeroJet::Java::ClassFile::ThrowsTarget>(stream, byteOrder);
+            targetInfo = AeroJet::Stream::Reader::read<AeroJet::Java::ClassFile::ThrowsTarget>(cursor);
             break;
         }
         case 0x40:
         case 0x41:
         {
-            targetInfo = AeroJet::Stream::Reader::read<AeroJet::Java::ClassFile::LocalVarTarget>(stream, byteOrder);
+            targetInfo = AeroJet::Java::ClassFile::LocalVarTarget::read(cursor, memoryResource);
             break;
         }
         case 0x42:
         {
-            targetInfo = AeroJet::Stream::Reader::read<AeroJet::Java::ClassFile::CatchTarget>(stream, byteOrder);
+            targetInfo = AeroJet::Stream::Reader::read<AeroJet::Java::ClassFile::CatchTarget>(cursor);
             break;
         }
         case 0x43:
@@ -375,7 +463,7 @@ AeroJet::Java::ClassFile::TypeAnnotation AeroJet::Stream::Reader::read(std::istr
         case 0x45:
         case 0x46:
         {
-            targetInfo = AeroJet::Stream::Reader::read<AeroJet::Java::ClassFile::OffsetTarget>(stream, byteOrder);
+            targetInfo = AeroJet::Stream::Reader::read<AeroJet::Java::ClassFile::OffsetTarget>(cursor);
             break;
         }
         case 0x47:
@@ -384,28 +472,41 @@ AeroJet::Java::ClassFile::TypeAnnotation AeroJet::Stream::Reader::read(std::istr
         case 0x4A:
         case 0x4B:
         {
-            targetInfo = AeroJet::Stream::Reader::read<AeroJet::Java::ClassFile::TypeArgumentTarget>(stream, byteOrder);
+            targetInfo = AeroJet::Stream::Reader::read<AeroJet::Java::ClassFile::TypeArgumentTarget>(cursor);
             break;
         }
         default:
             throw AeroJet::Exceptions::RuntimeException("Unknown targetType value {:#04x}!");
     }
 
-    const AeroJet::Java::ClassFile::TypePath targetPath =
-        AeroJet::Stream::Reader::read<AeroJet::Java::ClassFile::TypePath>(stream, byteOrder);
+    AeroJet::Java::ClassFile::TypePath targetPath = AeroJet::Java::ClassFile::TypePath::read(cursor, memoryResource);
 
-    const u2 typeIndex = AeroJet::Stream::Reader::read<u2>(stream, byteOrder);
+    const u2 typeIndex = AeroJet::Stream::Reader::read<u2>(cursor);
 
-    const u2 numElementValuePairs = AeroJet::Stream::Reader::read<u2>(stream, byteOrder);
+    const u2 numElementValuePairs = AeroJet::Stream::Reader::read<u2>(cursor);
 
-    std::vector<AeroJet::Java::ClassFile::ElementValuePair> elementValuePairs;
+    std::pmr::vector<AeroJet::Java::ClassFile::ElementValuePair> elementValuePairs{ memoryResource };
     elementValuePairs.reserve(numElementValuePairs);
     for(u2 elementValuePairIndex = 0; elementValuePairIndex < numElementValuePairs; elementValuePairIndex++)
     {
-        const AeroJet::Java::ClassFile::ElementValuePair elementValuePair =
-            AeroJet::Stream::Reader::read<AeroJet::Java::ClassFile::ElementValuePair>(stream, byteOrder);
-        elementValuePairs.emplace_back(elementValuePair);
+        elementValuePairs.emplace_back(AeroJet::Java::ClassFile::ElementValuePair::read(cursor, memoryResource));
     }
 
-    return Java::ClassFile::TypeAnnotation{ targetType, targetInfo, targetPath, typeIndex, elementValuePairs };
+    return Java::ClassFile::TypeAnnotation{ targetType,
+                                            std::move(targetInfo),
+                                            std::move(targetPath),
+                                            typeIndex,
+                                            std::move(elementValuePairs) };
+}
+
+template<>
+AeroJet::Java::ClassFile::TypeAnnotation AeroJet::Stream::Reader::read(ByteCursor& cursor)
+{
+    return AeroJet::Java::ClassFile::TypeAnnotation::read(cursor, std::pmr::get_default_resource());
+}
+
+template<>
+AeroJet::Java::ClassFile::TypeAnnotation AeroJet::Stream::Reader::read(std::istream& stream, ByteOrder /*byteOrder*/)
+{
+    return AeroJet::Stream::Reader::readBuffered<AeroJet::Java::ClassFile::TypeAnnotation>(stream);
 }
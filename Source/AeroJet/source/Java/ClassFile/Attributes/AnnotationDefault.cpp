@@ -29,9 +29,11 @@
 namespace AeroJet::Java::ClassFile
 {
 
-    AnnotationDefault::AnnotationDefault(const ConstantPool& constantPool, const AttributeInfo& attributeInfo) :
-        Attribute(constantPool, attributeInfo, ANNOTATION_DEFAULT_ATTRIBUTE_NAME),
-        m_defaultValue(Stream::Reader::read<ElementValue>(m_infoDataStream, Stream::ByteOrder::INVERSE))
+    AnnotationDefault::AnnotationDefault(const ConstantPool& constantPool,
+                                         const AttributeInfo& attributeInfo,
+                                         std::pmr::memory_resource* memoryResource) :
+        Attribute(constantPool, attributeInfo, AttributeKind::ANNOTATION_DEFAULT),
+        m_defaultValue(ElementValue::read(m_infoCursor, memoryResource))
     {
     }
 
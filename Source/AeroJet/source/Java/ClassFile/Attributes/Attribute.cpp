@@ -25,26 +25,31 @@
 #include "Java/ClassFile/Attributes/Attribute.hpp"
 
 #include "Exceptions/IncorrectAttributeTypeException.hpp"
-#include "Stream/StreamUtils.hpp"
 
 namespace AeroJet::Java::ClassFile
 {
     Attribute::Attribute(const ConstantPool& constantPool,
                          const AttributeInfo& attributeInfo,
-                         std::string_view requiredAttributeName)
+                         AttributeKind requiredKind)
     {
         const u2 nameIndex = attributeInfo.attributeNameIndex();
-        const std::string attributeName = constantPool.at(nameIndex).as<ConstantPoolInfoUtf8>().asString();
 
-        if(attributeName != requiredAttributeName)
+        // Attributes read without their constant pool carry no kind
+        AttributeKind kind = attributeInfo.kind();
+        if(kind == AttributeKind::UNKNOWN)
         {
-            throw Exceptions::IncorrectAttributeTypeException(requiredAttributeName, attributeName);
+            kind = attributeKind(constantPool.symbol(nameIndex));
         }
 
-        m_attributeNameIndex = nameIndex;
-        m_attributeLength = attributeInfo.size();
+        if(kind != requiredKind)
+        {
+            throw Exceptions::IncorrectAttributeTypeException(attributeKindName(requiredKind),
+                                                              constantPool.at(nameIndex).as<ConstantPoolInfoUtf8>().rawString());
+        }
 
-        m_infoDataStream = Stream::Utils::bytesToStream(attributeInfo.info());
+        m_attributeNameIndex = nameIndex;
+        m_attributeLength = static_cast<u4>(attributeInfo.info().size());
+        m_infoCursor = Stream::ByteCursor{ attributeInfo.info(), attributeInfo.storage() };
     }
 
     u2 Attribute::attributeNameIndex() const
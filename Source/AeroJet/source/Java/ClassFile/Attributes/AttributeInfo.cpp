@@ -29,9 +29,34 @@
 
 namespace AeroJet::Java::ClassFile
 {
-    AttributeInfo::AttributeInfo(u2 attributeIndex, std::vector<u1> info) :
-        m_attributeNameIndex(attributeIndex), m_info(std::move(info))
+    AttributeInfo::AttributeInfo(u2 attributeIndex, std::vector<u1> info, AttributeKind kind) :
+        m_attributeNameIndex(attributeIndex), m_kind(kind)
     {
+        auto storage = std::make_shared<const std::vector<u1>>(std::move(info));
+        m_info = *storage;
+        m_storage = std::move(storage);
+    }
+
+    AttributeInfo::AttributeInfo(u2 attributeIndex,
+                                 std::span<const u1> info,
+                                 std::shared_ptr<const void> storage,
+                                 AttributeKind kind) :
+        m_attributeNameIndex(attributeIndex), m_kind(kind), m_storage(std::move(storage)), m_info(info)
+    {
+    }
+
+    AttributeInfo::AttributeInfo(u2 attributeIndex,
+                                 std::span<const u1> info,
+                                 std::pmr::memory_resource* memoryResource,
+                                 AttributeKind kind) :
+        m_attributeNameIndex(attributeIndex), m_kind(kind)
+    {
+        // The allocator is passed on to the vector, so both the control block and the payload live in the resource
+        auto storage = std::allocate_shared<const std::pmr::vector<u1>>(std::pmr::polymorphic_allocator<u1>{ memoryResource },
+                                                                        info.begin(),
+                                                                        info.end());
+        m_info = *storage;
+        m_storage = std::move(storage);
     }
 
     u2 AttributeInfo::attributeNameIndex() const
@@ -39,30 +64,65 @@ namespace AeroJet::Java::ClassFile
         return m_attributeNameIndex;
     }
 
+    AttributeKind AttributeInfo::kind() const
+    {
+        return m_kind;
+    }
+
     u2 AttributeInfo::size() const
     {
         return m_info.size();
     }
 
-    const std::vector<u1>& AttributeInfo::info() const
+    std::span<const u1> AttributeInfo::info() const
     {
         return m_info;
     }
+
+    const std::shared_ptr<const void>& AttributeInfo::storage() const
+    {
+        return m_storage;
+    }
+
+    std::vector<u1> AttributeInfo::copyInfo() const
+    {
+        return { m_info.begin(), m_info.end() };
+    }
 } // namespace AeroJet::Java::ClassFile
 
 template<>
-AeroJet::Java::ClassFile::AttributeInfo AeroJet::Stream::Reader::read(std::istream& stream, ByteOrder byteOrder)
+AeroJet::Stream::ReadResult<AeroJet::Java::ClassFile::AttributeInfo> AeroJet::Stream::Reader::tryRead(ByteCursor& cursor)
 {
-    const AeroJet::u2 attributeNameIndex = AeroJet::Stream::Reader::read<AeroJet::u2>(stream, byteOrder);
-    const AeroJet::u4 attributeInfoSize = AeroJet::Stream::Reader::read<AeroJet::u4>(stream, byteOrder);
+    if(!cursor.canRead(sizeof(AeroJet::u2) + sizeof(AeroJet::u4)))
+    {
+        return readError(ReadErrorCode::UNEXPECTED_END, cursor.position());
+    }
 
-    std::vector<AeroJet::u1> attributeInfo;
-    attributeInfo.reserve(attributeInfoSize);
-    for(i4 attributeInfoIndex = 0; attributeInfoIndex < attributeInfoSize; attributeInfoIndex++)
+    const AeroJet::u2 attributeNameIndex = cursor.readUnchecked<AeroJet::u2>();
+    const AeroJet::u4 attributeInfoSize = cursor.readUnchecked<AeroJet::u4>();
+    if(!cursor.canRead(attributeInfoSize))
     {
-        const AeroJet::u1 byte = AeroJet::Stream::Reader::read<AeroJet::u1>(stream, byteOrder);
-        attributeInfo.emplace_back(byte);
+        return readError(ReadErrorCode::UNEXPECTED_END, cursor.position());
     }
 
-    return { attributeNameIndex, attributeInfo };
+    const std::span<const AeroJet::u1> attributeInfo = cursor.readBytes(attributeInfoSize);
+    if(cursor.owner())
+    {
+        return AeroJet::Java::ClassFile::AttributeInfo{ attributeNameIndex, attributeInfo, cursor.owner() };
+    }
+
+    return AeroJet::Java::ClassFile::AttributeInfo{ attributeNameIndex,
+                                                    std::vector<AeroJet::u1>{ attributeInfo.begin(), attributeInfo.end() } };
+}
+
+template<>
+AeroJet::Java::ClassFile::AttributeInfo AeroJet::Stream::Reader::read(ByteCursor& cursor)
+{
+    return valueOrThrow(tryRead<AeroJet::Java::ClassFile::AttributeInfo>(cursor));
+}
+
+template<>
+AeroJet::Java::ClassFile::AttributeInfo AeroJet::Stream::Reader::read(std::istream& stream, ByteOrder /*byteOrder*/)
+{
+    return AeroJet::Stream::Reader::readBuffered<AeroJet::Java::ClassFile::AttributeInfo>(stream);
 }
@@ -0,0 +1,206 @@
+/*
+ * AttributeKind.cpp
+ *
+ * Copyright © 2024 AeroJet Developers. All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the “Software”), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+ * OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "Java/ClassFile/Attributes/AttributeKind.hpp"
+
+#include "Java/ClassFile/Attributes/AttributeInfo.hpp"
+
+#include <unordered_map>
+
+namespace AeroJet::Java::ClassFile
+{
+    std::string_view attributeKindName(AttributeKind kind)
+    {
+        switch(kind)
+        {
+            case AttributeKind::UNKNOWN:
+                return "";
+            case AttributeKind::CONSTANT_VALUE:
+                return "ConstantValue";
+            case AttributeKind::CODE:
+                return "Code";
+            case AttributeKind::STACK_MAP_TABLE:
+                return "StackMapTable";
+            case AttributeKind::BOOTSTRAP_METHODS:
+                return "BootstrapMethods";
+            case AttributeKind::NEST_HOST:
+                return "NestHost";
+            case AttributeKind::NEST_MEMBERS:
+                return "NestMembers";
+            case AttributeKind::PERMITTED_SUBCLASSES:
+                return "PermittedSubclasses";
+            case AttributeKind::EXCEPTIONS:
+                return "Exceptions";
+            case AttributeKind::INNER_CLASSES:
+                return "InnerClasses";
+            case AttributeKind::ENCLOSING_METHOD:
+                return "EnclosingMethod";
+            case AttributeKind::SYNTHETIC:
+                return "Synthetic";
+            case AttributeKind::SIGNATURE:
+                return "Signature";
+            case AttributeKind::RECORD:
+                return "Record";
+            case AttributeKind::SOURCE_FILE:
+                return "SourceFile";
+            case AttributeKind::LINE_NUMBER_TABLE:
+                return "LineNumberTable";
+            case AttributeKind::LOCAL_VARIABLE_TABLE:
+                return "LocalVariableTable";
+            case AttributeKind::LOCAL_VARIABLE_TYPE_TABLE:
+                return "LocalVariableTypeTable";
+            case AttributeKind::SOURCE_DEBUG_EXTENSION:
+                return "SourceDebugExtension";
+            case AttributeKind::DEPRECATED:
+                return "Deprecated";
+            case AttributeKind::RUNTIME_VISIBLE_ANNOTATIONS:
+                return "RuntimeVisibleAnnotations";
+            case AttributeKind::RUNTIME_INVISIBLE_ANNOTATIONS:
+                return "RuntimeInvisibleAnnotations";
+            case AttributeKind::RUNTIME_VISIBLE_PARAMETER_ANNOTATIONS:
+                return "RuntimeVisibleParameterAnnotations";
+            case AttributeKind::RUNTIME_INVISIBLE_PARAMETER_ANNOTATIONS:
+                return "RuntimeInvisibleParameterAnnotations";
+            case AttributeKind::RUNTIME_VISIBLE_TYPE_ANNOTATIONS:
+                return "RuntimeVisibleTypeAnnotations";
+            case AttributeKind::RUNTIME_INVISIBLE_TYPE_ANNOTATIONS:
+                return "RuntimeInvisibleTypeAnnotations";
+            case AttributeKind::ANNOTATION_DEFAULT:
+                return "AnnotationDefault";
+            case AttributeKind::METHOD_PARAMETERS:
+                return "MethodParameters";
+            case AttributeKind::MODULE:
+                return "Module";
+            case AttributeKind::MODULE_PACKAGES:
+                return "ModulePackages";
+            case AttributeKind::MODULE_MAIN_CLASS:
+                return "ModuleMainClass";
+        }
+
+        return "";
+    }
+
+    AttributeKind attributeKind(SymbolId name)
+    {
+        // Interned once, names of attributes in every constant pool share these ids
+        static const std::unordered_map<SymbolId, AttributeKind> kinds = []()
+        {
+            std::unordered_map<SymbolId, AttributeKind> result;
+            for(std::size_t kindIndex = 1; kindIndex < ATTRIBUTE_KIND_COUNT; kindIndex++)
+            {
+                const auto kind = static_cast<AttributeKind>(kindIndex);
+                result.emplace(SymbolTable::global().intern(attributeKindName(kind)).id, kind);
+            }
+
+            return result;
+        }();
+
+        const auto kind = kinds.find(name);
+        return kind != kinds.end() ? kind->second : AttributeKind::UNKNOWN;
+    }
+
+    AttributeKind attributeKind(std::string_view name)
+    {
+        const std::optional<SymbolId> symbol = SymbolTable::global().find(name);
+        return symbol.has_value() ? attributeKind(symbol.value()) : AttributeKind::UNKNOWN;
+    }
+
+    AttributeKindResolver::AttributeKindResolver(const ConstantPool& constantPool, std::pmr::memory_resource* memoryResource) :
+        m_constantPool(&constantPool), m_caches(true), m_kinds(constantPool.slotCount(), 0, memoryResource)
+    {
+    }
+
+    AttributeKindResolver::AttributeKindResolver(const ConstantPool& constantPool, bool caches) :
+        m_constantPool(&constantPool), m_caches(caches)
+    {
+    }
+
+    AttributeKindResolver AttributeKindResolver::uncached(const ConstantPool& constantPool)
+    {
+        return AttributeKindResolver{ constantPool, false };
+    }
+
+    const ConstantPool& AttributeKindResolver::constantPool() const
+    {
+        return *m_constantPool;
+    }
+
+    AttributeKind AttributeKindResolver::resolve(u2 nameIndex)
+    {
+        const auto lookup = [this](u2 nameIndex)
+        {
+            if(m_constantPool->contains(nameIndex) && m_constantPool->at(nameIndex).tag() == ConstantPoolInfoTag::UTF_8)
+            {
+                return attributeKind(m_constantPool->symbol(nameIndex));
+            }
+
+            return AttributeKind::UNKNOWN;
+        };
+
+        if(!m_caches)
+        {
+            return lookup(nameIndex);
+        }
+
+        if(nameIndex >= m_kinds.size())
+        {
+            return AttributeKind::UNKNOWN;
+        }
+
+        if(m_kinds[nameIndex] == 0)
+        {
+            m_kinds[nameIndex] = static_cast<u1>(lookup(nameIndex)) + 1;
+        }
+
+        return static_cast<AttributeKind>(m_kinds[nameIndex] - 1);
+    }
+
+    AttributeKindIndex::AttributeKindIndex(std::span<const AttributeInfo> attributes)
+    {
+        for(std::size_t position = 0; position < attributes.size(); position++)
+        {
+            u2& slot = m_positions[static_cast<std::size_t>(attributes[position].kind())];
+            if(slot == 0)
+            {
+                slot = static_cast<u2>(position + 1);
+            }
+        }
+    }
+
+    std::optional<std::size_t> AttributeKindIndex::find(AttributeKind kind) const
+    {
+        if(kind == AttributeKind::UNKNOWN)
+        {
+            return std::nullopt;
+        }
+
+        const u2 position = m_positions[static_cast<std::size_t>(kind)];
+        if(position == 0)
+        {
+            return std::nullopt;
+        }
+
+        return position - 1;
+    }
+} // namespace AeroJet::Java::ClassFile
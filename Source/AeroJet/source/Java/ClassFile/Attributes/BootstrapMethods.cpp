@@ -52,20 +52,20 @@ namespace AeroJet::Java::ClassFile
     }
 
     BootstrapMethods::BootstrapMethods(const ConstantPool& constantPool, const AttributeInfo& attributeInfo) :
-        Attribute(constantPool, attributeInfo, BOOTSTRAP_METHODS_ATTRIBUTE_NAME)
+        Attribute(constantPool, attributeInfo, AttributeKind::BOOTSTRAP_METHODS)
     {
-        const u2 numBootstrapMethods = Stream::Reader::read<u2>(m_infoDataStream, Stream::ByteOrder::INVERSE);
+        const u2 numBootstrapMethods = Stream::Reader::read<u2>(m_infoCursor);
         m_bootstrapMethods.reserve(numBootstrapMethods);
         for(u2 bootstrapMethodIndex = 0; bootstrapMethodIndex < numBootstrapMethods; bootstrapMethodIndex++)
         {
-            const u2 bootstrapMethodRef = Stream::Reader::read<u2>(m_infoDataStream, Stream::ByteOrder::INVERSE);
+            const u2 bootstrapMethodRef = Stream::Reader::read<u2>(m_infoCursor);
 
-            const u2 numBootstrapArguments = Stream::Reader::read<u2>(m_infoDataStream, Stream::ByteOrder::INVERSE);
+            const u2 numBootstrapArguments = Stream::Reader::read<u2>(m_infoCursor);
             std::vector<u2> boostrapArguments{};
             boostrapArguments.reserve(numBootstrapArguments);
             for(u2 bootstrapArgumentIndex = 0; bootstrapArgumentIndex < numBootstrapArguments; bootstrapArgumentIndex++)
             {
-                const u2 bootstrapArgument = Stream::Reader::read<u2>(m_infoDataStream, Stream::ByteOrder::INVERSE);
+                const u2 bootstrapArgument = Stream::Reader::read<u2>(m_infoCursor);
                 boostrapArguments.emplace_back(bootstrapArgument);
             }
 
@@ -53,42 +53,43 @@ namespace AeroJet::Java::ClassFile
         return m_catchType;
     }
 
-    Code::Code(const ConstantPool& constantPool, const AttributeInfo& attributeInfo) :
-        Attribute(constantPool, attributeInfo, CODE_ATTRIBUTE_NAME)
+    Code::Code(const ConstantPool& constantPool,
+               const AttributeInfo& attributeInfo,
+               const AttributeFilter& attributeFilter,
+               std::pmr::memory_resource* memoryResource) :
+        Attribute(constantPool, attributeInfo, AttributeKind::CODE), m_code(memoryResource), m_exceptionTable(memoryResource),
+        m_attributes(memoryResource)
     {
-        m_maxStack = Stream::Reader::read<u2>(m_infoDataStream, Stream::ByteOrder::INVERSE);
-        m_maxLocals = Stream::Reader::read<u2>(m_infoDataStream, Stream::ByteOrder::INVERSE);
+        m_maxStack = Stream::Reader::read<u2>(m_infoCursor);
+        m_maxLocals = Stream::Reader::read<u2>(m_infoCursor);
 
-        const u4 codeLength = Stream::Reader::read<u4>(m_infoDataStream, Stream::ByteOrder::INVERSE);
+        const u4 codeLength = Stream::Reader::read<u4>(m_infoCursor);
 
-        const u4 currentPos = static_cast<u4>(m_infoDataStream.tellg());
+        const u4 currentPos = static_cast<u4>(m_infoCursor.position());
         const u4 endPos = currentPos + codeLength;
-        while(m_infoDataStream.tellg() != endPos)
+        // Operands of every instruction are assembled in the same buffer before being copied into the resource
+        Stream::ByteBuffer operands;
+        while(m_infoCursor.position() != endPos)
         {
-            m_code.emplace_back(
-                Stream::Reader::read<ByteCode::Instruction>(m_infoDataStream, Stream::ByteOrder::INVERSE));
+            m_code.emplace_back(ByteCode::Instruction::read(m_infoCursor, operands, memoryResource));
         }
 
-        const u2 exceptionTableLength = Stream::Reader::read<u2>(m_infoDataStream, Stream::ByteOrder::INVERSE);
+        const u2 exceptionTableLength = Stream::Reader::read<u2>(m_infoCursor);
         m_exceptionTable.reserve(exceptionTableLength);
         for(int32_t exceptionTableIndex = 0; exceptionTableIndex < exceptionTableLength; exceptionTableIndex++)
         {
-            const u2 startPc = Stream::Reader::read<u2>(m_infoDataStream, Stream::ByteOrder::INVERSE);
-            const u2 endPc = Stream::Reader::read<u2>(m_infoDataStream, Stream::ByteOrder::INVERSE);
-            const u2 handlePc = Stream::Reader::read<u2>(m_infoDataStream, Stream::ByteOrder::INVERSE);
-            const u2 catchType = Stream::Reader::read<u2>(m_infoDataStream, Stream::ByteOrder::INVERSE);
+            const u2 startPc = Stream::Reader::read<u2>(m_infoCursor);
+            const u2 endPc = Stream::Reader::read<u2>(m_infoCursor);
+            const u2 handlePc = Stream::Reader::read<u2>(m_infoCursor);
+            const u2 catchType = Stream::Reader::read<u2>(m_infoCursor);
 
             m_exceptionTable.emplace_back(startPc, endPc, handlePc, catchType);
         }
 
-        const u2 attributesCount = Stream::Reader::read<u2>(m_infoDataStream, Stream::ByteOrder::INVERSE);
-
-        m_attributes.reserve(attributesCount);
-        for(int32_t attributeIndex = 0; attributeIndex < attributesCount; attributeIndex++)
-        {
-            m_attributes.emplace_back(
-                Stream::Reader::read<AttributeInfo>(m_infoDataStream, Stream::ByteOrder::INVERSE));
-        }
+        const u2 attributesCount = Stream::Reader::read<u2>(m_infoCursor);
+        AttributeKindResolver resolver = AttributeKindResolver::uncached(constantPool);
+        m_attributes = Stream::Reader::valueOrThrow(attributeFilter.tryRead(m_infoCursor, attributesCount, &resolver, memoryResource));
+        m_attributeIndex = AttributeKindIndex{ m_attributes };
     }
 
     u2 Code::maxStack() const
@@ -101,18 +102,24 @@ namespace AeroJet::Java::ClassFile
         return m_maxLocals;
     }
 
-    const std::vector<ByteCode::Instruction>& Code::code() const
+    AeroJet::Utils::TableView<ByteCode::Instruction> Code::code() const
     {
         return m_code;
     }
 
-    const std::vector<Code::ExceptionTableEntry>& Code::exceptionTable() const
+    AeroJet::Utils::TableView<Code::ExceptionTableEntry> Code::exceptionTable() const
     {
         return m_exceptionTable;
     }
 
-    const std::vector<AttributeInfo>& Code::attributes() const
+    AeroJet::Utils::TableView<AttributeInfo> Code::attributes() const
     {
         return m_attributes;
     }
+
+    const AttributeInfo* Code::findAttribute(AttributeKind kind) const
+    {
+        const std::optional<std::size_t> position = m_attributeIndex.find(kind);
+        return position.has_value() ? &m_attributes[position.value()] : nullptr;
+    }
 } // namespace AeroJet::Java::ClassFile
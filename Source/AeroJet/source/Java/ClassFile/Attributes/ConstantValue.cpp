@@ -29,9 +29,9 @@
 namespace AeroJet::Java::ClassFile
 {
     ConstantValue::ConstantValue(const ConstantPool& constantPool, const AttributeInfo& attributeInfo) :
-        Attribute(constantPool, attributeInfo, CONSTANT_VALUE_ATTRIBUTE_NAME)
+        Attribute(constantPool, attributeInfo, AttributeKind::CONSTANT_VALUE)
     {
-        m_constantValueIndex = Stream::Reader::read<u2>(m_infoDataStream, Stream::ByteOrder::INVERSE);
+        m_constantValueIndex = Stream::Reader::read<u2>(m_infoCursor);
     }
 
     u2 ConstantValue::constantValueIndex() const
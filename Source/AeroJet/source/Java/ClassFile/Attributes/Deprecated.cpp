@@ -29,7 +29,7 @@
 namespace AeroJet::Java::ClassFile
 {
     Deprecated::Deprecated(const ConstantPool& constantPool, const AttributeInfo& attributeInfo) :
-        Attribute(constantPool, attributeInfo, DEPRECATED_ATTRIBUTE_NAME)
+        Attribute(constantPool, attributeInfo, AttributeKind::DEPRECATED)
     {
         if(m_attributeLength != 0)
         {
@@ -29,10 +29,10 @@
 namespace AeroJet::Java::ClassFile
 {
     EnclosingMethod::EnclosingMethod(const ConstantPool& constantPool, const AttributeInfo& attributeInfo) :
-        Attribute(constantPool, attributeInfo, ENCLOSING_METHOD_ATTRIBUTE_NAME)
+        Attribute(constantPool, attributeInfo, AttributeKind::ENCLOSING_METHOD)
     {
-        m_classIndex = Stream::Reader::read<u2>(m_infoDataStream, Stream::ByteOrder::INVERSE);
-        m_methodIndex = Stream::Reader::read<u2>(m_infoDataStream, Stream::ByteOrder::INVERSE);
+        m_classIndex = Stream::Reader::read<u2>(m_infoCursor);
+        m_methodIndex = Stream::Reader::read<u2>(m_infoCursor);
     }
 
     u2 EnclosingMethod::classIndex() const
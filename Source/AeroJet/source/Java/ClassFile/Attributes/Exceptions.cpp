@@ -29,15 +29,10 @@
 namespace AeroJet::Java::ClassFile
 {
     Exceptions::Exceptions(const ConstantPool& constantPool, const AttributeInfo& attributeInfo) :
-        Attribute(constantPool, attributeInfo, EXCEPTIONS_ATTRIBUTE_NAME)
+        Attribute(constantPool, attributeInfo, AttributeKind::EXCEPTIONS)
     {
-        const u2 numberOfExceptions = Stream::Reader::read<u2>(m_infoDataStream, Stream::ByteOrder::INVERSE);
-        m_exceptionIndexTable.reserve(numberOfExceptions);
-
-        for(size_t exceptionIndex = 0; exceptionIndex < numberOfExceptions; exceptionIndex++)
-        {
-            m_exceptionIndexTable.emplace_back(Stream::Reader::read<u2>(m_infoDataStream, Stream::ByteOrder::INVERSE));
-        }
+        const u2 numberOfExceptions = Stream::Reader::read<u2>(m_infoCursor);
+        m_exceptionIndexTable = m_infoCursor.readArray<u2>(numberOfExceptions);
     }
 
     u2 Exceptions::numberOfExceptions()
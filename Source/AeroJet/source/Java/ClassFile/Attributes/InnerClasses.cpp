@@ -60,17 +60,17 @@ namespace AeroJet::Java::ClassFile
     }
 
     InnerClasses::InnerClasses(const ConstantPool& constantPool, const AttributeInfo& attributeInfo) :
-        Attribute(constantPool, attributeInfo, INNER_CLASSES_ATTRIBUTE_NAME)
+        Attribute(constantPool, attributeInfo, AttributeKind::INNER_CLASSES)
     {
-        const u2 numberOfClasses = Stream::Reader::read<u2>(m_infoDataStream, Stream::ByteOrder::INVERSE);
+        const u2 numberOfClasses = Stream::Reader::read<u2>(m_infoCursor);
         m_InnerClasses.reserve(numberOfClasses);
         for(size_t classIndex = 0; classIndex < numberOfClasses; classIndex++)
         {
-            u2 innerClassInfoIndex = Stream::Reader::read<u2>(m_infoDataStream, Stream::ByteOrder::INVERSE);
-            u2 outerClassInfoIndex = Stream::Reader::read<u2>(m_infoDataStream, Stream::ByteOrder::INVERSE);
-            u2 innerNameIndex = Stream::Reader::read<u2>(m_infoDataStream, Stream::ByteOrder::INVERSE);
+            u2 innerClassInfoIndex = Stream::Reader::read<u2>(m_infoCursor);
+            u2 outerClassInfoIndex = Stream::Reader::read<u2>(m_infoCursor);
+            u2 innerNameIndex = Stream::Reader::read<u2>(m_infoCursor);
             InnerClassAccessFlags innerClassAccessFlags = static_cast<InnerClassAccessFlags>(
-                Stream::Reader::read<u2>(m_infoDataStream, Stream::ByteOrder::INVERSE));
+                Stream::Reader::read<u2>(m_infoCursor));
 
             m_InnerClasses.emplace_back(innerClassInfoIndex,
                                         outerClassInfoIndex,
@@ -44,16 +44,15 @@ namespace AeroJet::Java::ClassFile
     }
 
     LineNumberTable::LineNumberTable(const ConstantPool& constantPool, const AttributeInfo& attributeInfo) :
-        Attribute(constantPool, attributeInfo, LINE_NUMBER_TABLE_ATTRIBUTE_NAME)
+        Attribute(constantPool, attributeInfo, AttributeKind::LINE_NUMBER_TABLE)
     {
-        const u2 lineNumberTableLength = Stream::Reader::read<u2>(m_infoDataStream, Stream::ByteOrder::INVERSE);
+        const u2 lineNumberTableLength = Stream::Reader::read<u2>(m_infoCursor);
+        const std::vector<u2> entries = m_infoCursor.readArray<u2>(lineNumberTableLength * ENTRY_FIELDS_COUNT);
+
         m_lineNumberTable.reserve(lineNumberTableLength);
-        for(i4 lineNumberTableEntryIndex = 0; lineNumberTableEntryIndex < lineNumberTableLength;
-            lineNumberTableEntryIndex++)
+        for(std::size_t entryOffset = 0; entryOffset < entries.size(); entryOffset += ENTRY_FIELDS_COUNT)
         {
-            const u2 startPc = Stream::Reader::read<u2>(m_infoDataStream, Stream::ByteOrder::INVERSE);
-            const u2 lineNumber = Stream::Reader::read<u2>(m_infoDataStream, Stream::ByteOrder::INVERSE);
-            m_lineNumberTable.emplace_back(startPc, lineNumber);
+            m_lineNumberTable.emplace_back(entries[entryOffset], entries[entryOffset + 1]);
         }
     }
 
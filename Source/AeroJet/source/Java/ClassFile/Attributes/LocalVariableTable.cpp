@@ -65,24 +65,19 @@ namespace AeroJet::Java::ClassFile
     }
 
     LocalVariableTable::LocalVariableTable(const ConstantPool& constantPool, const AttributeInfo& attributeInfo) :
-        Attribute(constantPool, attributeInfo, LOCAL_VARIABLE_TABLE_ATTRIBUTE_NAME)
+        Attribute(constantPool, attributeInfo, AttributeKind::LOCAL_VARIABLE_TABLE)
     {
-        const u2 localVariableTableLength = Stream::Reader::read<u2>(m_infoDataStream, Stream::ByteOrder::INVERSE);
+        const u2 localVariableTableLength = Stream::Reader::read<u2>(m_infoCursor);
+        const std::vector<u2> entries = m_infoCursor.readArray<u2>(localVariableTableLength * ENTRY_FIELDS_COUNT);
+
         m_localVariableTable.reserve(localVariableTableLength);
-        for(int32_t localVariableTableIndex = 0; localVariableTableIndex < localVariableTableLength;
-            localVariableTableIndex++)
+        for(std::size_t entryOffset = 0; entryOffset < entries.size(); entryOffset += ENTRY_FIELDS_COUNT)
         {
-            const u2 entryStartPc = Stream::Reader::read<u2>(m_infoDataStream, Stream::ByteOrder::INVERSE);
-            const u2 entryLength = Stream::Reader::read<u2>(m_infoDataStream, Stream::ByteOrder::INVERSE);
-            const u2 entryNameIndex = Stream::Reader::read<u2>(m_infoDataStream, Stream::ByteOrder::INVERSE);
-            const u2 entryDescriptorIndex = Stream::Reader::read<u2>(m_infoDataStream, Stream::ByteOrder::INVERSE);
-            const u2 entryIndex = Stream::Reader::read<u2>(m_infoDataStream, Stream::ByteOrder::INVERSE);
-
-            m_localVariableTable.emplace_back(entryStartPc,
-                                              entryLength,
-                                              entryNameIndex,
-                                              entryDescriptorIndex,
-                                              entryIndex);
+            m_localVariableTable.emplace_back(entries[entryOffset],
+                                              entries[entryOffset + 1],
+                                              entries[entryOffset + 2],
+                                              entries[entryOffset + 3],
+                                              entries[entryOffset + 4]);
         }
     }
 
@@ -65,19 +65,19 @@ namespace AeroJet::Java::ClassFile
 
     LocalVariableTypeTable::LocalVariableTypeTable(const ConstantPool& constantPool,
                                                    const AttributeInfo& attributeInfo) :
-        Attribute(constantPool, attributeInfo, LOCAL_VARIABLE_TYPES_TABLE_ATTRIBUTE_NAME)
+        Attribute(constantPool, attributeInfo, AttributeKind::LOCAL_VARIABLE_TYPE_TABLE)
     {
-        const u2 localVariableTypeTableLength = Stream::Reader::read<u2>(m_infoDataStream, Stream::ByteOrder::INVERSE);
+        const u2 localVariableTypeTableLength = Stream::Reader::read<u2>(m_infoCursor);
         m_localVariableTypeTable.reserve(localVariableTypeTableLength);
 
         for(int32_t localVariableTypeTableIndex = 0; localVariableTypeTableIndex < localVariableTypeTableLength;
             localVariableTypeTableIndex++)
         {
-            const u2 startPc = Stream::Reader::read<u2>(m_infoDataStream, Stream::ByteOrder::INVERSE);
-            const u2 length = Stream::Reader::read<u2>(m_infoDataStream, Stream::ByteOrder::INVERSE);
-            const u2 nameIndex = Stream::Reader::read<u2>(m_infoDataStream, Stream::ByteOrder::INVERSE);
-            const u2 signatureIndex = Stream::Reader::read<u2>(m_infoDataStream, Stream::ByteOrder::INVERSE);
-            const u2 index = Stream::Reader::read<u2>(m_infoDataStream, Stream::ByteOrder::INVERSE);
+            const u2 startPc = Stream::Reader::read<u2>(m_infoCursor);
+            const u2 length = Stream::Reader::read<u2>(m_infoCursor);
+            const u2 nameIndex = Stream::Reader::read<u2>(m_infoCursor);
+            const u2 signatureIndex = Stream::Reader::read<u2>(m_infoCursor);
+            const u2 index = Stream::Reader::read<u2>(m_infoCursor);
 
             m_localVariableTypeTable.emplace_back(startPc, length, nameIndex, signatureIndex, index);
         }
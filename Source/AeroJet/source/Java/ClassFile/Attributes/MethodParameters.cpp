@@ -47,16 +47,16 @@ namespace AeroJet::Java::ClassFile
     }
 
     MethodParameters::MethodParameters(const ConstantPool& constantPool, const AttributeInfo& attributeInfo) :
-        Attribute(constantPool, attributeInfo, METHOD_PARAMETERS_ATTRIBUTE_NAME)
+        Attribute(constantPool, attributeInfo, AttributeKind::METHOD_PARAMETERS)
     {
-        const u1 parametersCount = Stream::Reader::read<u1>(m_infoDataStream, Stream::ByteOrder::INVERSE);
+        const u1 parametersCount = Stream::Reader::read<u1>(m_infoCursor);
 
         m_methodParameters.reserve(parametersCount);
         for(u1 parameterIndex = 0; parameterIndex < parametersCount; parameterIndex++)
         {
-            const u2 nameIndex = Stream::Reader::read<u2>(m_infoDataStream, Stream::ByteOrder::INVERSE);
+            const u2 nameIndex = Stream::Reader::read<u2>(m_infoCursor);
             const MethodParameterAccessFlags accessFlags = static_cast<MethodParameterAccessFlags>(
-                Stream::Reader::read<u2>(m_infoDataStream, Stream::ByteOrder::INVERSE));
+                Stream::Reader::read<u2>(m_infoCursor));
 
             m_methodParameters.emplace_back(nameIndex, accessFlags);
         }
@@ -30,17 +30,17 @@ namespace AeroJet::Java::ClassFile
 {
 
     RuntimeInvisibleAnnotations::RuntimeInvisibleAnnotations(const ConstantPool& constantPool,
-                                                             const AttributeInfo& attributeInfo) :
-        Attribute(constantPool, attributeInfo, RUNTIME_INVISIBLE_ANNOTATIONS_ATTRIBUTE_NAME)
+                                                             const AttributeInfo& attributeInfo,
+                                                             std::pmr::memory_resource* memoryResource) :
+        Attribute(constantPool, attributeInfo, AttributeKind::RUNTIME_INVISIBLE_ANNOTATIONS),
+        m_annotations(memoryResource)
     {
-        const u2 numAnnotations = Stream::Reader::read<u2>(m_infoDataStream, Stream::ByteOrder::INVERSE);
+        const u2 numAnnotations = Stream::Reader::read<u2>(m_infoCursor);
 
         m_annotations.reserve(numAnnotations);
         for(u2 annotationIndex = 0; annotationIndex < numAnnotations; annotationIndex++)
         {
-            const Annotation annotation =
-                Stream::Reader::read<Annotation>(m_infoDataStream, Stream::ByteOrder::INVERSE);
-            m_annotations.emplace_back(annotation);
+            m_annotations.emplace_back(Annotation::read(m_infoCursor, memoryResource));
         }
     }
 
@@ -49,7 +49,7 @@ namespace AeroJet::Java::ClassFile
         return m_annotations.size();
     }
 
-    const std::vector<Annotation>& RuntimeInvisibleAnnotations::annotations() const
+    AeroJet::Utils::TableView<Annotation> RuntimeInvisibleAnnotations::annotations() const
     {
         return m_annotations;
     }
@@ -30,16 +30,17 @@ namespace AeroJet::Java::ClassFile
 {
 
     RuntimeInvisibleParameterAnnotations::RuntimeInvisibleParameterAnnotations(const ConstantPool& constantPool,
-                                                                               const AttributeInfo& attributeInfo) :
-        Attribute(constantPool, attributeInfo, RUNTIME_INVISIBLE_PARAMETER_ANNOTATIONS_ATTRIBUTE_NAME)
+                                                                               const AttributeInfo& attributeInfo,
+                                                                               std::pmr::memory_resource* memoryResource) :
+        Attribute(constantPool, attributeInfo, AttributeKind::RUNTIME_INVISIBLE_PARAMETER_ANNOTATIONS),
+        m_parameterAnnotations(memoryResource)
     {
-        const u1 numParameters = Stream::Reader::read<u1>(m_infoDataStream, Stream::ByteOrder::INVERSE);
+        const u1 numParameters = Stream::Reader::read<u1>(m_infoCursor);
         m_parameterAnnotations.reserve(numParameters);
 
         for(u1 parameterAnnotationIndex = 0; parameterAnnotationIndex < numParameters; parameterAnnotationIndex++)
         {
-            m_parameterAnnotations.emplace_back(
-                Stream::Reader::read<ParameterAnnotation>(m_infoDataStream, Stream::ByteOrder::INVERSE));
+            m_parameterAnnotations.emplace_back(ParameterAnnotation::read(m_infoCursor, memoryResource));
         }
     }
 
@@ -48,7 +49,7 @@ namespace AeroJet::Java::ClassFile
         return m_parameterAnnotations.size();
     }
 
-    const std::vector<ParameterAnnotation>& RuntimeInvisibleParameterAnnotations::parameterAnnotations() const
+    AeroJet::Utils::TableView<ParameterAnnotation> RuntimeInvisibleParameterAnnotations::parameterAnnotations() const
     {
         return m_parameterAnnotations;
     }
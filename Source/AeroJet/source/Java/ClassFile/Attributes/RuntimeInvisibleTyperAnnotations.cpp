@@ -28,17 +28,17 @@
 namespace AeroJet::Java::ClassFile
 {
     RuntimeInvisibleTyperAnnotations::RuntimeInvisibleTyperAnnotations(const ConstantPool& constantPool,
-                                                                       const AttributeInfo& attributeInfo) :
-        Attribute(constantPool, attributeInfo, RUNTIME_INVISIBLE_TYPE_ANNOTATIONS_ATTRIBUTE_NAME)
+                                                                       const AttributeInfo& attributeInfo,
+                                                                       std::pmr::memory_resource* memoryResource) :
+        Attribute(constantPool, attributeInfo, AttributeKind::RUNTIME_INVISIBLE_TYPE_ANNOTATIONS),
+        m_annotations(memoryResource)
     {
-        const u2 numAnnotations = Stream::Reader::read<u2>(m_infoDataStream, Stream::ByteOrder::INVERSE);
+        const u2 numAnnotations = Stream::Reader::read<u2>(m_infoCursor);
         m_annotations.reserve(numAnnotations);
 
         for(u2 annotationIndex = 0; annotationIndex < numAnnotations; annotationIndex++)
         {
-            const TypeAnnotation typeAnnotation =
-                Stream::Reader::read<TypeAnnotation>(m_infoDataStream, Stream::ByteOrder::INVERSE);
-            m_annotations.emplace_back(typeAnnotation);
+            m_annotations.emplace_back(TypeAnnotation::read(m_infoCursor, memoryResource));
         }
     }
 } // namespace AeroJet::Java::ClassFile
@@ -30,17 +30,17 @@ namespace AeroJet::Java::ClassFile
 {
 
     RuntimeVisibleTyperAnnotations::RuntimeVisibleTyperAnnotations(const ConstantPool& constantPool,
-                                                                   const AttributeInfo& attributeInfo) :
-        Attribute(constantPool, attributeInfo, RUNTIME_VISIBLE_TYPE_ANNOTATIONS_ATTRIBUTE_NAME)
+                                                                   const AttributeInfo& attributeInfo,
+                                                                   std::pmr::memory_resource* memoryResource) :
+        Attribute(constantPool, attributeInfo, AttributeKind::RUNTIME_VISIBLE_TYPE_ANNOTATIONS),
+        m_annotations(memoryResource)
     {
-        const u2 numAnnotations = Stream::Reader::read<u2>(m_infoDataStream, Stream::ByteOrder::INVERSE);
+        const u2 numAnnotations = Stream::Reader::read<u2>(m_infoCursor);
         m_annotations.reserve(numAnnotations);
 
         for(u2 annotationIndex = 0; annotationIndex < numAnnotations; annotationIndex++)
         {
-            const TypeAnnotation typeAnnotation =
-                Stream::Reader::read<TypeAnnotation>(m_infoDataStream, Stream::ByteOrder::INVERSE);
-            m_annotations.emplace_back(typeAnnotation);
+            m_annotations.emplace_back(TypeAnnotation::read(m_infoCursor, memoryResource));
         }
     }
 
@@ -49,7 +49,7 @@ namespace AeroJet::Java::ClassFile
         return m_annotations.size();
     }
 
-    const std::vector<TypeAnnotation>& RuntimeVisibleTyperAnnotations::annotations() const
+    AeroJet::Utils::TableView<TypeAnnotation> RuntimeVisibleTyperAnnotations::annotations() const
     {
         return m_annotations;
     }
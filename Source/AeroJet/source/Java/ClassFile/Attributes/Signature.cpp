@@ -30,7 +30,7 @@
 namespace AeroJet::Java::ClassFile
 {
     Signature::Signature(const ConstantPool &constantPool, const AttributeInfo &attributeInfo) :
-        Attribute(constantPool, attributeInfo, SIGNATURE_ATTRIBUTE_NAME)
+        Attribute(constantPool, attributeInfo, AttributeKind::SIGNATURE)
     {
         /**
          * The value of the attribute_length item of a Signature_attribute structure must be two.
@@ -42,7 +42,7 @@ namespace AeroJet::Java::ClassFile
                 "The value of the attributeLength item of a Signature attribute structure must be two");
         }
 
-        m_signatureIndex = Stream::Reader::read<u2>(m_infoDataStream, Stream::ByteOrder::INVERSE);
+        m_signatureIndex = Stream::Reader::read<u2>(m_infoCursor);
     }
 
     u2 Signature::signatureIndex() const
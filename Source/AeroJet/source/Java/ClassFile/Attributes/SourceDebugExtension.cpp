@@ -30,14 +30,10 @@ namespace AeroJet::Java::ClassFile
 {
 
     SourceDebugExtension::SourceDebugExtension(const ConstantPool& constantPool, const AttributeInfo& attributeInfo) :
-        Attribute(constantPool, attributeInfo, SOURCE_DEBUG_EXTENSION_ATTRIBUTE_NAME)
+        Attribute(constantPool, attributeInfo, AttributeKind::SOURCE_DEBUG_EXTENSION)
     {
-        m_debugExtension.reserve(m_attributeLength);
-        for(size_t index = 0; index < m_attributeLength; index++)
-        {
-            const u1 byte = Stream::Reader::read<u1>(m_infoDataStream, Stream::ByteOrder::INVERSE);
-            m_debugExtension.emplace_back(byte);
-        }
+        const std::span<const u1> debugExtension = m_infoCursor.readBytes(m_attributeLength);
+        m_debugExtension.assign(debugExtension.begin(), debugExtension.end());
     }
 
     const std::vector<u1>& SourceDebugExtension::debugExtension() const
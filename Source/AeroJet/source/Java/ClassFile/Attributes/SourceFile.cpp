@@ -31,9 +31,9 @@
 namespace AeroJet::Java::ClassFile
 {
     SourceFile::SourceFile(const ConstantPool& constantPool, const AttributeInfo& attributeInfo) :
-        Attribute(constantPool, attributeInfo, SOURCE_FILE_ATTRIBUTE_NAME)
+        Attribute(constantPool, attributeInfo, AttributeKind::SOURCE_FILE)
     {
-        m_sourceFileIndex = Stream::Reader::read<u2>(m_infoDataStream, Stream::ByteOrder::INVERSE);
+        m_sourceFileIndex = Stream::Reader::read<u2>(m_infoCursor);
     }
 
     u2 SourceFile::sourceFileIndex() const
@@ -29,10 +29,10 @@
 #include "Stream/Reader.hpp"
 
 template<>
-AeroJet::Java::ClassFile::VerificationTypeInfo AeroJet::Stream::Reader::read(std::istream& stream, ByteOrder byteOrder)
+AeroJet::Java::ClassFile::VerificationTypeInfo AeroJet::Stream::Reader::read(ByteCursor& cursor)
 {
     const Java::ClassFile::VerificationTypeTag tag =
-        static_cast<Java::ClassFile::VerificationTypeTag>(Stream::Reader::read<u1>(stream, Stream::ByteOrder::INVERSE));
+        static_cast<Java::ClassFile::VerificationTypeTag>(Stream::Reader::read<u1>(cursor));
 
     switch(tag)
     {
@@ -58,12 +58,12 @@ AeroJet::Java::ClassFile::VerificationTypeInfo AeroJet::Stream::Reader::read(std
         }
         case Java::ClassFile::VerificationTypeTag::ITEM_OBJECT:
         {
-            const u2 constantPoolIndex = AeroJet::Stream::Reader::read<u2>(stream, byteOrder);
+            const u2 constantPoolIndex = AeroJet::Stream::Reader::read<u2>(cursor);
             return Java::ClassFile::ObjectVariableInfo{ constantPoolIndex };
         }
         case Java::ClassFile::VerificationTypeTag::ITEM_UNINITIALIZED:
         {
-            const u2 offset = AeroJet::Stream::Reader::read<u2>(stream, byteOrder);
+            const u2 offset = AeroJet::Stream::Reader::read<u2>(cursor);
             return Java::ClassFile::UninitializedVariableInfo{ offset };
         }
         case Java::ClassFile::VerificationTypeTag::ITEM_LONG:
@@ -80,6 +80,12 @@ AeroJet::Java::ClassFile::VerificationTypeInfo AeroJet::Stream::Reader::read(std
     }
 }
 
+template<>
+AeroJet::Java::ClassFile::VerificationTypeInfo AeroJet::Stream::Reader::read(std::istream& stream, ByteOrder /*byteOrder*/)
+{
+    return AeroJet::Stream::Reader::readBuffered<AeroJet::Java::ClassFile::VerificationTypeInfo>(stream);
+}
+
 namespace AeroJet::Java::ClassFile
 {
     TopVariableInfo::TopVariableInfo() :
@@ -303,12 +309,12 @@ namespace AeroJet::Java::ClassFile
     }
 
     StackMapTable::StackMapTable(const ConstantPool& constantPool, const AttributeInfo& attributeInfo) :
-        Attribute(constantPool, attributeInfo, STACK_MAP_TABLE_ATTRIBUTE_NAME)
+        Attribute(constantPool, attributeInfo, AttributeKind::STACK_MAP_TABLE)
     {
-        const u2 numberOfEntries = Stream::Reader::read<u2>(m_infoDataStream, Stream::ByteOrder::INVERSE);
+        const u2 numberOfEntries = Stream::Reader::read<u2>(m_infoCursor);
         for(u2 entryIndex = 0; entryIndex < numberOfEntries; entryIndex++)
         {
-            const u1 frameType = Stream::Reader::read<u1>(m_infoDataStream, Stream::ByteOrder::INVERSE);
+            const u1 frameType = Stream::Reader::read<u1>(m_infoCursor);
             if(frameType >= SameFrame::SAME_FRAME_MIN_TAG_VALUE && frameType <= SameFrame::SAME_FRAME_MAX_TAG_VALUE)
             {
                 m_entries.emplace_back(StackMapFrame{ SameFrame{ frameType } });
@@ -317,15 +323,15 @@ namespace AeroJet::Java::ClassFile
                     frameType <= SameLocals1StackItemFrame::SAME_LOCALS_1_STACK_ITEM_MAX_TAG_VALUE)
             {
                 const VerificationTypeInfo verificationTypeInfo =
-                    Stream::Reader::read<VerificationTypeInfo>(m_infoDataStream, Stream::ByteOrder::INVERSE);
+                    Stream::Reader::read<VerificationTypeInfo>(m_infoCursor);
 
                 m_entries.emplace_back(StackMapFrame{ SameLocals1StackItemFrame{ frameType, verificationTypeInfo } });
             }
             else if(frameType == SameLocals1StackItemFrameExtended::SAME_LOCALS_1_STACK_ITEM_EXTENDED_TAG_VALUE)
             {
-                const u2 offsetDelta = Stream::Reader::read<u2>(m_infoDataStream, Stream::ByteOrder::INVERSE);
+                const u2 offsetDelta = Stream::Reader::read<u2>(m_infoCursor);
                 const VerificationTypeInfo verificationTypeInfo =
-                    Stream::Reader::read<VerificationTypeInfo>(m_infoDataStream, Stream::ByteOrder::INVERSE);
+                    Stream::Reader::read<VerificationTypeInfo>(m_infoCursor);
 
                 m_entries.emplace_back(
                     StackMapFrame{ SameLocals1StackItemFrameExtended{ offsetDelta, verificationTypeInfo } });
@@ -333,18 +339,18 @@ namespace AeroJet::Java::ClassFile
             else if(frameType >= ChopFrame::CHOP_FRAME_MIN_TAG_VALUE &&
                     frameType <= ChopFrame::CHOP_FRAME_MAX_TAG_VALUE)
             {
-                const u2 offsetDelta = Stream::Reader::read<u2>(m_infoDataStream, Stream::ByteOrder::INVERSE);
+                const u2 offsetDelta = Stream::Reader::read<u2>(m_infoCursor);
                 m_entries.emplace_back(StackMapFrame{ ChopFrame{ frameType, offsetDelta } });
             }
             else if(frameType == SameFrameExtended::SAME_FRAME_EXTENDED_TAG_VALUE)
             {
-                const u2 offsetDelta = Stream::Reader::read<u2>(m_infoDataStream, Stream::ByteOrder::INVERSE);
+                const u2 offsetDelta = Stream::Reader::read<u2>(m_infoCursor);
                 m_entries.emplace_back(StackMapFrame{ SameFrameExtended{ offsetDelta } });
             }
             else if(frameType >= AppendFrame::APPEND_FRAME_MIN_TAG_VALUE &&
                     frameType <= AppendFrame::APPEND_FRAME_MAX_TAG_VALUE)
             {
-                const u2 offsetDelta = Stream::Reader::read<u2>(m_infoDataStream, Stream::ByteOrder::INVERSE);
+                const u2 offsetDelta = Stream::Reader::read<u2>(m_infoCursor);
 
                 const u1 localsSize = frameType - 251;
                 std::vector<VerificationTypeInfo> locals;
@@ -353,7 +359,7 @@ namespace AeroJet::Java::ClassFile
                 for(u1 localsIndex = 0; localsIndex < localsSize; localsIndex++)
                 {
                     VerificationTypeInfo verificationTypeInfo =
-                        Stream::Reader::read<VerificationTypeInfo>(m_infoDataStream, Stream::ByteOrder::INVERSE);
+                        Stream::Reader::read<VerificationTypeInfo>(m_infoCursor);
 
                     locals.emplace_back(verificationTypeInfo);
                 }
@@ -362,8 +368,8 @@ namespace AeroJet::Java::ClassFile
             }
             else if(frameType == FullFrame::FULL_FRAME_TAG_VALUE)
             {
-                const u2 offsetDelta = Stream::Reader::read<u2>(m_infoDataStream, Stream::ByteOrder::INVERSE);
-                const u2 numberOfLocals = Stream::Reader::read<u2>(m_infoDataStream, Stream::ByteOrder::INVERSE);
+                const u2 offsetDelta = Stream::Reader::read<u2>(m_infoCursor);
+                const u2 numberOfLocals = Stream::Reader::read<u2>(m_infoCursor);
 
                 std::vector<VerificationTypeInfo> locals;
                 locals.reserve(numberOfLocals);
@@ -371,19 +377,19 @@ namespace AeroJet::Java::ClassFile
                 for(u1 localsIndex = 0; localsIndex < numberOfLocals; localsIndex++)
                 {
                     VerificationTypeInfo verificationTypeInfo =
-                        Stream::Reader::read<VerificationTypeInfo>(m_infoDataStream, Stream::ByteOrder::INVERSE);
+                        Stream::Reader::read<VerificationTypeInfo>(m_infoCursor);
 
                     locals.emplace_back(verificationTypeInfo);
                 }
 
-                const u2 numberOfStackItems = Stream::Reader::read<u2>(m_infoDataStream, Stream::ByteOrder::INVERSE);
+                const u2 numberOfStackItems = Stream::Reader::read<u2>(m_infoCursor);
                 std::vector<VerificationTypeInfo> stack;
                 stack.reserve(numberOfStackItems);
 
                 for(u1 stackItemIndex = 0; stackItemIndex < numberOfLocals; stackItemIndex++)
                 {
                     VerificationTypeInfo verificationTypeInfo =
-                        Stream::Reader::read<VerificationTypeInfo>(m_infoDataStream, Stream::ByteOrder::INVERSE);
+                        Stream::Reader::read<VerificationTypeInfo>(m_infoCursor);
 
                     stack.emplace_back(verificationTypeInfo);
                 }
@@ -29,7 +29,7 @@
 namespace AeroJet::Java::ClassFile
 {
     Synthetic::Synthetic(const ConstantPool &constantPool, const AttributeInfo &attributeInfo) :
-        Attribute(constantPool, attributeInfo, SYNTHETIC_ATTRIBUTE_NAME)
+        Attribute(constantPool, attributeInfo, AttributeKind::SYNTHETIC)
     {
         /**
          * The value of the attribute_length item must be zero.
@@ -0,0 +1,225 @@
+/*
+ * ClassHeader.cpp
+ *
+ * Copyright © 2024 AeroJet Developers. All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the “Software”), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+ * OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "Java/ClassFile/ClassHeader.hpp"
+
+#include "Stream/MappedFile.hpp"
+#include "Stream/Reader.hpp"
+
+#include <utility>
+
+namespace AeroJet::Java::ClassFile
+{
+    ClassHeader::ClassHeader(u2 minorVersion,
+                             u2 majorVersion,
+                             ConstantPool constantPool,
+                             u2 accessFlags,
+                             u2 thisClass,
+                             std::optional<u2> superClass,
+                             std::pmr::vector<u2> interfaces) :
+        m_minorVersion(minorVersion),
+        m_majorVersion(majorVersion), m_constantPool(std::move(constantPool)), m_accessFlags(accessFlags),
+        m_thisClass(thisClass), m_superClass(superClass), m_interfaces(std::move(interfaces))
+    {
+    }
+
+    ClassHeader ClassHeader::load(const std::filesystem::path& path, ConstantPool::Decoding decoding)
+    {
+        return Stream::Reader::valueOrThrow(tryLoad(path, decoding));
+    }
+
+    ClassHeader ClassHeader::load(std::vector<u1> bytes, ConstantPool::Decoding decoding)
+    {
+        return Stream::Reader::valueOrThrow(tryLoad(std::move(bytes), decoding));
+    }
+
+    Stream::ReadResult<ClassHeader> ClassHeader::tryLoad(const std::filesystem::path& path, ConstantPool::Decoding decoding)
+    {
+        auto mappedFile = std::make_shared<const Stream::MappedFile>(path);
+        const std::span<const u1> bytes = mappedFile->bytes();
+
+        return tryLoad(std::move(mappedFile), bytes, decoding);
+    }
+
+    Stream::ReadResult<ClassHeader> ClassHeader::tryLoad(std::vector<u1> bytes, ConstantPool::Decoding decoding)
+    {
+        auto storage = std::make_shared<const std::vector<u1>>(std::move(bytes));
+        const std::span<const u1> view{ *storage };
+
+        return tryLoad(std::move(storage), view, decoding);
+    }
+
+    Stream::ReadResult<ClassHeader> ClassHeader::tryLoad(std::shared_ptr<const void> storage,
+                                                         std::span<const u1> bytes,
+                                                         ConstantPool::Decoding decoding)
+    {
+        // A lazily decoded constant pool keeps the storage alive on its own
+        Stream::ByteCursor cursor{ bytes, std::move(storage) };
+        return tryRead(cursor, decoding);
+    }
+
+    Stream::ReadResult<ClassHeader> ClassHeader::tryRead(Stream::ByteCursor& cursor,
+                                                         ConstantPool::Decoding decoding,
+                                                         std::pmr::memory_resource* memoryResource)
+    {
+        if(!cursor.canRead(sizeof(u4) + sizeof(u2) * 3))
+        {
+            return Stream::readError(Stream::ReadErrorCode::UNEXPECTED_END, cursor.position());
+        }
+
+        const u4 magic = cursor.readUnchecked<u4>();
+        if(magic != ClassInfo::JAVA_CLASS_MAGIC)
+        {
+            return Stream::readError(Stream::ReadErrorCode::NOT_A_CLASS_FILE, cursor.position() - sizeof(u4));
+        }
+
+        const u2 minorVersion = cursor.readUnchecked<u2>();
+        const u2 majorVersion = cursor.readUnchecked<u2>();
+
+        if(majorVersion > ClassInfo::MAX_JAVA_CLASS_MAJOR_VERSION)
+        {
+            return Stream::readError(Stream::ReadErrorCode::UNSUPPORTED_CLASS_VERSION, cursor.position() - sizeof(u2));
+        }
+
+        const u2 constantPoolSize = cursor.readUnchecked<u2>();
+        Stream::ReadResult<ConstantPool> constantPool = ConstantPool::tryRead(cursor, constantPoolSize, decoding, memoryResource);
+        if(!constantPool)
+        {
+            return Unexpected{ constantPool.error() };
+        }
+
+        if(!cursor.canRead(sizeof(u2) * 4))
+        {
+            return Stream::readError(Stream::ReadErrorCode::UNEXPECTED_END, cursor.position());
+        }
+
+        const u2 accessFlags = cursor.readUnchecked<u2>();
+        const u2 thisClass = cursor.readUnchecked<u2>();
+        const u2 superClass = cursor.readUnchecked<u2>();
+        const u2 interfacesCount = cursor.readUnchecked<u2>();
+
+        if(!cursor.canRead(sizeof(u2) * interfacesCount))
+        {
+            return Stream::readError(Stream::ReadErrorCode::UNEXPECTED_END, cursor.position());
+        }
+
+        std::pmr::vector<u2> interfaces(interfacesCount, memoryResource);
+        cursor.readArray(std::span<u2>{ interfaces });
+
+        return ClassHeader{ minorVersion,
+                            majorVersion,
+                            std::move(constantPool).value(),
+                            accessFlags,
+                            thisClass,
+                            superClass == 0 ? std::nullopt : std::optional<u2>(superClass),
+                            std::move(interfaces) };
+    }
+
+    u2 ClassHeader::minorVersion() const
+    {
+        return m_minorVersion;
+    }
+
+    u2 ClassHeader::majorVersion() const
+    {
+        return m_majorVersion;
+    }
+
+    const ConstantPool& ClassHeader::constantPool() const
+    {
+        return m_constantPool;
+    }
+
+    ClassInfo::AccessFlags ClassHeader::accessFlags() const
+    {
+        return static_cast<ClassInfo::AccessFlags>(m_accessFlags);
+    }
+
+    u2 ClassHeader::thisClass() const
+    {
+        return m_thisClass;
+    }
+
+    std::optional<u2> ClassHeader::superClass() const
+    {
+        return m_superClass;
+    }
+
+    AeroJet::Utils::TableView<u2> ClassHeader::interfaces() const
+    {
+        return m_interfaces;
+    }
+
+    std::string_view ClassHeader::name() const
+    {
+        return className(m_thisClass);
+    }
+
+    std::optional<std::string_view> ClassHeader::superClassName() const
+    {
+        if(!m_superClass.has_value())
+        {
+            return std::nullopt;
+        }
+
+        return className(*m_superClass);
+    }
+
+    std::vector<std::string_view> ClassHeader::interfaceNames() const
+    {
+        std::vector<std::string_view> names;
+        names.reserve(m_interfaces.size());
+
+        for(const u2 interface : m_interfaces)
+        {
+            names.push_back(className(interface));
+        }
+
+        return names;
+    }
+
+    std::string_view ClassHeader::className(u2 index) const
+    {
+        const u2 nameIndex = m_constantPool.at(index).as<ConstantPoolInfoClass>().nameIndex();
+        return m_constantPool.at(nameIndex).as<ConstantPoolInfoUtf8>().rawString();
+    }
+} // namespace AeroJet::Java::ClassFile
+
+template<>
+AeroJet::Stream::ReadResult<AeroJet::Java::ClassFile::ClassHeader> AeroJet::Stream::Reader::tryRead(ByteCursor& cursor)
+{
+    return AeroJet::Java::ClassFile::ClassHeader::tryRead(cursor, AeroJet::Java::ClassFile::ConstantPool::Decoding::EAGER);
+}
+
+template<>
+AeroJet::Java::ClassFile::ClassHeader AeroJet::Stream::Reader::read(ByteCursor& cursor)
+{
+    return valueOrThrow(tryRead<AeroJet::Java::ClassFile::ClassHeader>(cursor));
+}
+
+template<>
+AeroJet::Java::ClassFile::ClassHeader AeroJet::Stream::Reader::read(std::istream& stream, ByteOrder /*byteOrder*/)
+{
+    return AeroJet::Stream::Reader::readBuffered<AeroJet::Java::ClassFile::ClassHeader>(stream);
+}
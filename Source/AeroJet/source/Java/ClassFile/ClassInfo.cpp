@@ -26,26 +26,168 @@
 
 #include "Exceptions/RuntimeException.hpp"
 #include "fmt/format.h"
+#include "Java/ClassFile/ClassHeader.hpp"
 #include "Java/ClassFile/Utils/ClassInfoUtils.hpp"
+#include "Stream/MappedFile.hpp"
 #include "Stream/Reader.hpp"
 
+template<>
+AeroJet::Stream::ReadResult<AeroJet::Java::ClassFile::ClassInfo> AeroJet::Stream::Reader::tryRead(ByteCursor& cursor);
+
 namespace AeroJet::Java::ClassFile
 {
     ClassInfo::ClassInfo(u2 minorVersion,
                          u2 majorVersion,
-                         ConstantPool& constantPool,
+                         ConstantPool constantPool,
                          u2 accessFlags,
                          u2 thisClass,
                          std::optional<u2> superClass,
-                         const std::vector<u2>& interfaces,
-                         const std::vector<FieldInfo>& fields,
-                         const std::vector<MethodInfo>& methods,
-                         const std::vector<AttributeInfo>& attributes) :
+                         std::pmr::vector<u2> interfaces,
+                         std::pmr::vector<FieldInfo> fields,
+                         std::pmr::vector<MethodInfo> methods,
+                         std::pmr::vector<AttributeInfo> attributes) :
         m_minorVersion(minorVersion),
-        m_majorVersion(majorVersion), m_constantPool(constantPool), m_accessFlags(accessFlags), m_thisClass(thisClass),
-        m_superClass(superClass), m_interfaces(interfaces), m_fields(fields), m_methods(methods),
-        m_attributes(attributes)
+        m_majorVersion(majorVersion), m_constantPool(std::move(constantPool)),
+        m_accessFlags(accessFlags), m_thisClass(thisClass),
+        m_superClass(superClass), m_interfaces(std::move(interfaces)), m_fields(std::move(fields)), m_methods(std::move(methods)),
+        m_attributes(std::move(attributes)), m_attributeIndex(m_attributes)
+    {
+    }
+
+    ClassInfo ClassInfo::load(const std::filesystem::path& path,
+                              ConstantPool::Decoding decoding,
+                              std::pmr::memory_resource* memoryResource,
+                              const AttributeFilter& attributeFilter)
+    {
+        return Stream::Reader::valueOrThrow(tryLoad(path, decoding, memoryResource, attributeFilter));
+    }
+
+    ClassInfo ClassInfo::load(std::vector<u1> bytes,
+                              ConstantPool::Decoding decoding,
+                              std::pmr::memory_resource* memoryResource,
+                              const AttributeFilter& attributeFilter)
+    {
+        return Stream::Reader::valueOrThrow(tryLoad(std::move(bytes), decoding, memoryResource, attributeFilter));
+    }
+
+    Stream::ReadResult<ClassInfo> ClassInfo::tryLoad(const std::filesystem::path& path,
+                                                     ConstantPool::Decoding decoding,
+                                                     std::pmr::memory_resource* memoryResource,
+                                                     const AttributeFilter& attributeFilter)
+    {
+        auto mappedFile = std::make_shared<const Stream::MappedFile>(path);
+        const std::span<const u1> bytes = mappedFile->bytes();
+
+        return tryLoad(std::move(mappedFile), bytes, decoding, memoryResource, attributeFilter);
+    }
+
+    Stream::ReadResult<ClassInfo> ClassInfo::tryLoad(std::vector<u1> bytes,
+                                                     ConstantPool::Decoding decoding,
+                                                     std::pmr::memory_resource* memoryResource,
+                                                     const AttributeFilter& attributeFilter)
+    {
+        auto storage = std::make_shared<const std::vector<u1>>(std::move(bytes));
+        const std::span<const u1> view{ *storage };
+
+        return tryLoad(std::move(storage), view, decoding, memoryResource, attributeFilter);
+    }
+
+    Stream::ReadResult<ClassInfo> ClassInfo::tryLoad(std::shared_ptr<const void> storage,
+                                                     std::span<const u1> bytes,
+                                                     ConstantPool::Decoding decoding,
+                                                     std::pmr::memory_resource* memoryResource,
+                                                     const AttributeFilter& attributeFilter)
+    {
+        Stream::ByteCursor cursor{ bytes, storage };
+        Stream::ReadResult<ClassInfo> classInfo = tryRead(cursor, decoding, memoryResource, attributeFilter);
+        if(classInfo)
+        {
+            classInfo->m_storage = std::move(storage);
+            classInfo->m_bytes = bytes;
+        }
+
+        return classInfo;
+    }
+
+    Stream::ReadResult<ClassInfo> ClassInfo::tryRead(Stream::ByteCursor& cursor,
+                                                     ConstantPool::Decoding decoding,
+                                                     std::pmr::memory_resource* memoryResource,
+                                                     const AttributeFilter& attributeFilter)
+    {
+        Stream::ReadResult<ClassHeader> header = ClassHeader::tryRead(cursor, decoding, memoryResource);
+        if(!header)
+        {
+            return Unexpected{ header.error() };
+        }
+
+        AttributeKindResolver resolver{ header->m_constantPool, memoryResource };
+
+        if(!cursor.canRead(sizeof(u2)))
+        {
+            return Stream::readError(Stream::ReadErrorCode::UNEXPECTED_END, cursor.position());
+        }
+
+        const u2 fieldsCount = cursor.readUnchecked<u2>();
+        std::pmr::vector<FieldInfo> fields{ memoryResource };
+        fields.reserve(fieldsCount);
+        for(int fieldIndex = 0; fieldIndex < fieldsCount; fieldIndex++)
+        {
+            Stream::ReadResult<FieldInfo> field = FieldInfo::tryRead(cursor, resolver, attributeFilter, memoryResource);
+            if(!field)
+            {
+                return Unexpected{ field.error() };
+            }
+
+            fields.emplace_back(std::move(field).value());
+        }
+
+        if(!cursor.canRead(sizeof(u2)))
+        {
+            return Stream::readError(Stream::ReadErrorCode::UNEXPECTED_END, cursor.position());
+        }
+
+        const u2 readMethodsCount = cursor.readUnchecked<u2>();
+        std::pmr::vector<MethodInfo> methods{ memoryResource };
+        methods.reserve(readMethodsCount);
+        for(int methodIndex = 0; methodIndex < readMethodsCount; methodIndex++)
+        {
+            Stream::ReadResult<MethodInfo> method = MethodInfo::tryRead(cursor, resolver, attributeFilter, memoryResource);
+            if(!method)
+            {
+                return Unexpected{ method.error() };
+            }
+
+            methods.emplace_back(std::move(method).value());
+        }
+
+        if(!cursor.canRead(sizeof(u2)))
+        {
+            return Stream::readError(Stream::ReadErrorCode::UNEXPECTED_END, cursor.position());
+        }
+
+        const u2 readAttributesCount = cursor.readUnchecked<u2>();
+        Stream::ReadResult<std::pmr::vector<AttributeInfo>> attributes =
+            attributeFilter.tryRead(cursor, readAttributesCount, &resolver, memoryResource);
+        if(!attributes)
+        {
+            return Unexpected{ attributes.error() };
+        }
+
+        return ClassInfo{ header->m_minorVersion,
+                          header->m_majorVersion,
+                          std::move(header->m_constantPool),
+                          header->m_accessFlags,
+                          header->m_thisClass,
+                          header->m_superClass,
+                          std::move(header->m_interfaces),
+                          std::move(fields),
+                          std::move(methods),
+                          std::move(attributes).value() };
+    }
+
+    std::span<const u1> ClassInfo::bytes() const
     {
+        return m_bytes;
     }
 
     u2 ClassInfo::minorVersion() const
@@ -63,6 +205,11 @@ namespace AeroJet::Java::ClassFile
         return m_constantPool;
     }
 
+    const ResolvedReference& ClassInfo::resolve(u2 index) const
+    {
+        return m_resolutionCache.resolve(m_constantPool, index);
+    }
+
     ClassInfo::AccessFlags ClassInfo::accessFlags() const
     {
         return static_cast<AccessFlags>(m_accessFlags);
@@ -89,102 +236,47 @@ namespace AeroJet::Java::ClassFile
         return m_superClass.value();
     }
 
-    const std::vector<u2>& ClassInfo::interfaces() const
+    AeroJet::Utils::TableView<u2> ClassInfo::interfaces() const
     {
         return m_interfaces;
     }
 
-    const std::vector<FieldInfo>& ClassInfo::fields() const
+    AeroJet::Utils::TableView<FieldInfo> ClassInfo::fields() const
     {
         return m_fields;
     }
 
-    const std::vector<MethodInfo>& ClassInfo::methods() const
+    AeroJet::Utils::TableView<MethodInfo> ClassInfo::methods() const
     {
         return m_methods;
     }
 
-    const std::vector<AttributeInfo>& ClassInfo::attributes() const
+    AeroJet::Utils::TableView<AttributeInfo> ClassInfo::attributes() const
     {
         return m_attributes;
     }
-} // namespace AeroJet::Java::ClassFile
 
-template<>
-AeroJet::Java::ClassFile::ClassInfo AeroJet::Stream::Reader::read(std::istream& stream, ByteOrder byteOrder)
-{
-    static constexpr AeroJet::u2 MAX_JAVA_CLASS_MAJOR_VERSION = 52;
-
-    const AeroJet::u4 magic = AeroJet::Stream::Reader::read<AeroJet::u4>(stream, byteOrder);
-    if(magic != AeroJet::Java::ClassFile::ClassInfo::JAVA_CLASS_MAGIC)
-    {
-        throw AeroJet::Exceptions::RuntimeException("Not a Java class!");
-    }
-
-    const AeroJet::u2 minorVersion = AeroJet::Stream::Reader::read<AeroJet::u2>(stream, byteOrder);
-    const AeroJet::u2 majorVersion = AeroJet::Stream::Reader::read<AeroJet::u2>(stream, byteOrder);
-
-    if(majorVersion > MAX_JAVA_CLASS_MAJOR_VERSION)
+    const AttributeInfo* ClassInfo::findAttribute(AttributeKind kind) const
     {
-        throw Exceptions::RuntimeException(
-            fmt::format("Unsupported java class version file {}! Maximum supported version is: {}",
-                        majorVersion,
-                        MAX_JAVA_CLASS_MAJOR_VERSION));
-    }
-
-    const AeroJet::u2 constantPoolSize = AeroJet::Stream::Reader::read<AeroJet::u2>(stream, byteOrder);
-    AeroJet::Java::ClassFile::ConstantPool constantPool;
-    for(int constantPoolEntryIndex = 1; constantPoolEntryIndex < constantPoolSize; constantPoolEntryIndex++)
-    {
-        AeroJet::Java::ClassFile::ConstantPoolEntry entry =
-            AeroJet::Stream::Reader::read<AeroJet::Java::ClassFile::ConstantPoolEntry>(stream, byteOrder);
-        const AeroJet::Java::ClassFile::ConstantPoolInfoTag tag = entry.tag();
-
-        constantPool.insert({ constantPoolEntryIndex, std::move(entry) });
-
-        if(tag == AeroJet::Java::ClassFile::ConstantPoolInfoTag::LONG ||
-           tag == AeroJet::Java::ClassFile::ConstantPoolInfoTag::DOUBLE)
-        {
-            constantPoolEntryIndex++;
-        }
-    }
-
-    const AeroJet::u2 accessFlags = AeroJet::Stream::Reader::read<AeroJet::u2>(stream, byteOrder);
-    const AeroJet::u2 thisClass = AeroJet::Stream::Reader::read<AeroJet::u2>(stream, byteOrder);
-    const AeroJet::u2 superClass = AeroJet::Stream::Reader::read<AeroJet::u2>(stream, byteOrder);
-    const AeroJet::u2 interfacesCount = AeroJet::Stream::Reader::read<AeroJet::u2>(stream, byteOrder);
-
-    std::vector<AeroJet::u2> interfaces;
-    interfaces.reserve(interfacesCount);
-    for(int interfaceIndex = 0; interfaceIndex < interfacesCount; interfaceIndex++)
-    {
-        interfaces.emplace_back(AeroJet::Stream::Reader::read<AeroJet::u2>(stream, byteOrder));
-    }
-
-    const AeroJet::u2 fieldsCount = AeroJet::Stream::Reader::read<AeroJet::u2>(stream, byteOrder);
-    std::vector<AeroJet::Java::ClassFile::FieldInfo> fields;
-    fields.reserve(fieldsCount);
-    for(int fieldIndex = 0; fieldIndex < fieldsCount; fieldIndex++)
-    {
-        fields.emplace_back(AeroJet::Stream::Reader::read<AeroJet::Java::ClassFile::FieldInfo>(stream, byteOrder));
+        const std::optional<std::size_t> position = m_attributeIndex.find(kind);
+        return position.has_value() ? &m_attributes[position.value()] : nullptr;
     }
+} // namespace AeroJet::Java::ClassFile
 
-    const AeroJet::u2 readMethodsCount = AeroJet::Stream::Reader::read<AeroJet::u2>(stream, byteOrder);
-    std::vector<AeroJet::Java::ClassFile::MethodInfo> methods;
-    methods.reserve(readMethodsCount);
-    for(int methodIndex = 0; methodIndex < readMethodsCount; methodIndex++)
-    {
-        methods.emplace_back(AeroJet::Stream::Reader::read<AeroJet::Java::ClassFile::MethodInfo>(stream, byteOrder));
-    }
+template<>
+AeroJet::Stream::ReadResult<AeroJet::Java::ClassFile::ClassInfo> AeroJet::Stream::Reader::tryRead(ByteCursor& cursor)
+{
+    return AeroJet::Java::ClassFile::ClassInfo::tryRead(cursor, AeroJet::Java::ClassFile::ConstantPool::Decoding::EAGER);
+}
 
-    const AeroJet::u2 readAttributesCount = AeroJet::Stream::Reader::read<AeroJet::u2>(stream, byteOrder);
-    std::vector<AeroJet::Java::ClassFile::AttributeInfo> attributes;
-    attributes.reserve(readAttributesCount);
-    for(int attributeIndex = 0; attributeIndex < readAttributesCount; attributeIndex++)
-    {
-        attributes.emplace_back(
-            AeroJet::Stream::Reader::read<AeroJet::Java::ClassFile::AttributeInfo>(stream, byteOrder));
-    }
+template<>
+AeroJet::Java::ClassFile::ClassInfo AeroJet::Stream::Reader::read(ByteCursor& cursor)
+{
+    return valueOrThrow(tryRead<AeroJet::Java::ClassFile::ClassInfo>(cursor));
+}
 
-    return { minorVersion, majorVersion, constantPool, accessFlags, thisClass, superClass == 0 ? std::nullopt : std::optional<AeroJet::u2>(superClass), interfaces, fields, methods, attributes };
+template<>
+AeroJet::Java::ClassFile::ClassInfo AeroJet::Stream::Reader::read(std::istream& stream, ByteOrder /*byteOrder*/)
+{
+    return AeroJet::Stream::Reader::readBuffered<AeroJet::Java::ClassFile::ClassInfo>(stream);
 }
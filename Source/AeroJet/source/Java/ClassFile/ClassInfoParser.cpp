@@ -0,0 +1,415 @@
+/*
+ * ClassInfoParser.cpp
+ *
+ * Copyright © 2024 AeroJet Developers. All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the “Software”), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+ * OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "Java/ClassFile/ClassInfoParser.hpp"
+
+#include "Exceptions/RuntimeException.hpp"
+#include "fmt/format.h"
+#include "Stream/ByteCursor.hpp"
+#include "Stream/Reader.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace AeroJet::Java::ClassFile
+{
+    ClassInfoParser::ClassInfoParser(AttributeFilter attributeFilter) :
+        m_attributeFilter(std::move(attributeFilter))
+    {
+    }
+
+    ClassInfoParser::State ClassInfoParser::feed(std::span<const u1> chunk)
+    {
+        if(m_state != State::NEED_MORE_DATA)
+        {
+            return m_state;
+        }
+
+        // Parse straight from the chunk when there is no incomplete structure left from the previous one
+        const bool buffered = m_pendingBegin != m_pending.size();
+        if(buffered)
+        {
+            // Consumed bytes are dropped once they outweigh the unconsumed ones, so that every byte is moved a bounded
+            // number of times even when a large structure arrives in many small chunks
+            if(m_pendingBegin >= m_pending.size() - m_pendingBegin)
+            {
+                m_pending.erase(m_pending.begin(), m_pending.begin() + static_cast<std::ptrdiff_t>(m_pendingBegin));
+                m_pendingBegin = 0;
+            }
+
+            m_pending.insert(m_pending.end(), chunk.begin(), chunk.end());
+            chunk = std::span<const u1>{ m_pending }.subspan(m_pendingBegin);
+        }
+
+        Stream::ByteCursor cursor{ chunk };
+        while(step(cursor))
+        {
+        }
+
+        m_pendingOffset += cursor.position();
+        if(m_state != State::NEED_MORE_DATA)
+        {
+            m_pending.clear();
+            m_pendingBegin = 0;
+        }
+        else if(buffered)
+        {
+            m_pendingBegin += cursor.position();
+        }
+        else
+        {
+            const std::span<const u1> tail = chunk.subspan(cursor.position());
+            m_pending.assign(tail.begin(), tail.end());
+            m_pendingBegin = 0;
+        }
+
+        return m_state;
+    }
+
+    ClassInfoParser::State ClassInfoParser::finish()
+    {
+        if(m_state == State::NEED_MORE_DATA)
+        {
+            m_state = State::FAILED;
+            m_error = { Stream::ReadErrorCode::UNEXPECTED_END, m_pendingOffset + m_pending.size() - m_pendingBegin };
+        }
+
+        return m_state;
+    }
+
+    ClassInfoParser::State ClassInfoParser::state() const
+    {
+        return m_state;
+    }
+
+    const Stream::ReadError& ClassInfoParser::error() const
+    {
+        return m_error;
+    }
+
+    std::size_t ClassInfoParser::consumed() const
+    {
+        return m_pendingOffset;
+    }
+
+    ClassInfo ClassInfoParser::result()
+    {
+        if(m_state == State::FAILED)
+        {
+            throw Exceptions::RuntimeException(fmt::format("{} at {:#08x}", m_error.description(), m_error.offset));
+        }
+
+        if(m_state != State::COMPLETE)
+        {
+            throw Exceptions::RuntimeException("Class file is not parsed completely yet!");
+        }
+
+        if(m_resultTaken)
+        {
+            throw Exceptions::RuntimeException("Parsed class has already been taken!");
+        }
+
+        m_resultTaken = true;
+        return { m_minorVersion,
+                 m_majorVersion,
+                 std::move(m_constantPool),
+                 m_accessFlags,
+                 m_thisClass,
+                 m_superClass == 0 ? std::nullopt : std::optional<u2>(m_superClass),
+                 std::move(m_interfaces),
+                 std::move(m_fields),
+                 std::move(m_methods),
+                 std::move(m_attributes) };
+    }
+
+    ClassInfo ClassInfoParser::parse(std::istream& stream, std::size_t chunkSize, const AttributeFilter& attributeFilter)
+    {
+        ClassInfoParser parser{ attributeFilter };
+        std::vector<u1> chunk(chunkSize);
+
+        while(parser.state() == State::NEED_MORE_DATA)
+        {
+            stream.read(reinterpret_cast<char*>(chunk.data()), static_cast<std::streamsize>(chunk.size()));
+            if(stream.bad())
+            {
+                throw Exceptions::RuntimeException(fmt::format("Failed to read class file at {:#08x}", parser.consumed()));
+            }
+
+            const std::size_t readCount = static_cast<std::size_t>(stream.gcount());
+            if(readCount == 0)
+            {
+                parser.finish();
+                break;
+            }
+
+            parser.feed({ chunk.data(), readCount });
+        }
+
+        return parser.result();
+    }
+
+    bool ClassInfoParser::step(Stream::ByteCursor& cursor)
+    {
+        switch(m_stage)
+        {
+            case Stage::HEADER:
+            {
+                if(!cursor.canRead(sizeof(u4) + sizeof(u2) * 3))
+                {
+                    return false;
+                }
+
+                if(cursor.readUnchecked<u4>() != ClassInfo::JAVA_CLASS_MAGIC)
+                {
+                    return fail(Stream::ReadErrorCode::NOT_A_CLASS_FILE, cursor.position() - sizeof(u4));
+                }
+
+                m_minorVersion = cursor.readUnchecked<u2>();
+                m_majorVersion = cursor.readUnchecked<u2>();
+                if(m_majorVersion > ClassInfo::MAX_JAVA_CLASS_MAJOR_VERSION)
+                {
+                    return fail(Stream::ReadErrorCode::UNSUPPORTED_CLASS_VERSION, cursor.position() - sizeof(u2));
+                }
+
+                m_constantPoolSize = cursor.readUnchecked<u2>();
+                m_constantPool.reserve(m_constantPoolSize);
+                m_stage = Stage::CONSTANT_POOL;
+                return true;
+            }
+            case Stage::CONSTANT_POOL:
+            {
+                if(m_constantPoolIndex >= m_constantPoolSize)
+                {
+                    m_attributeKinds.emplace(m_constantPool);
+                    m_stage = Stage::CLASS_HEADER;
+                    return true;
+                }
+
+                const std::size_t entryPosition = cursor.position();
+                Stream::ReadResult<ConstantPoolEntry> entry = Stream::Reader::tryRead<ConstantPoolEntry>(cursor);
+                if(!entry)
+                {
+                    if(entry.error().code == Stream::ReadErrorCode::UNEXPECTED_END)
+                    {
+                        cursor.seek(entryPosition);
+                        return false;
+                    }
+
+                    return fail(entry.error().code, entry.error().offset);
+                }
+
+                const ConstantPoolInfoTag tag = entry->tag();
+                m_constantPool.insert({ m_constantPoolIndex, std::move(entry).value() });
+                m_constantPoolIndex += (tag == ConstantPoolInfoTag::LONG || tag == ConstantPoolInfoTag::DOUBLE) ? 2 : 1;
+                return true;
+            }
+            case Stage::CLASS_HEADER:
+            {
+                if(!cursor.canRead(sizeof(u2) * 4))
+                {
+                    return false;
+                }
+
+                m_accessFlags = cursor.readUnchecked<u2>();
+                m_thisClass = cursor.readUnchecked<u2>();
+                m_superClass = cursor.readUnchecked<u2>();
+                m_interfacesCount = cursor.readUnchecked<u2>();
+                m_stage = Stage::INTERFACES;
+                return true;
+            }
+            case Stage::INTERFACES:
+            {
+                if(!cursor.canRead(sizeof(u2) * m_interfacesCount))
+                {
+                    return false;
+                }
+
+                m_interfaces.resize(m_interfacesCount);
+                cursor.readArray(std::span<u2>{ m_interfaces });
+                m_stage = Stage::FIELDS_COUNT;
+                return true;
+            }
+            case Stage::FIELDS_COUNT:
+            case Stage::METHODS_COUNT:
+            case Stage::ATTRIBUTES_COUNT:
+            {
+                if(!cursor.canRead(sizeof(u2)))
+                {
+                    return false;
+                }
+
+                const u2 count = cursor.readUnchecked<u2>();
+                if(m_stage == Stage::FIELDS_COUNT)
+                {
+                    m_membersCount = count;
+                    m_fields.reserve(count);
+                    m_stage = Stage::FIELD_HEADER;
+                }
+                else if(m_stage == Stage::METHODS_COUNT)
+                {
+                    m_membersCount = count;
+                    m_methods.reserve(count);
+                    m_stage = Stage::METHOD_HEADER;
+                }
+                else
+                {
+                    m_attributesCount = count;
+                    m_attributesRead = 0;
+                    if(m_attributeFilter.keepsAll())
+                    {
+                        m_attributes.reserve(count);
+                    }
+                    m_stage = Stage::ATTRIBUTES;
+                }
+                return true;
+            }
+            case Stage::FIELD_HEADER:
+            case Stage::METHOD_HEADER:
+            {
+                const bool isField = m_stage == Stage::FIELD_HEADER;
+                const std::size_t parsedCount = isField ? m_fields.size() : m_methods.size();
+                if(parsedCount == m_membersCount)
+                {
+                    m_stage = isField ? Stage::METHODS_COUNT : Stage::ATTRIBUTES_COUNT;
+                    return true;
+                }
+
+                if(!cursor.canRead(sizeof(u2) * 4))
+                {
+                    return false;
+                }
+
+                m_member = {};
+                m_member.accessFlags = cursor.readUnchecked<u2>();
+                m_member.nameIndex = cursor.readUnchecked<u2>();
+                m_member.descriptorIndex = cursor.readUnchecked<u2>();
+                m_member.attributesCount = cursor.readUnchecked<u2>();
+                m_attributesRead = 0;
+                if(m_attributeFilter.keepsAll())
+                {
+                    m_member.attributes.reserve(m_member.attributesCount);
+                }
+                m_stage = isField ? Stage::FIELD_ATTRIBUTES : Stage::METHOD_ATTRIBUTES;
+                return true;
+            }
+            case Stage::FIELD_ATTRIBUTES:
+            case Stage::METHOD_ATTRIBUTES:
+            {
+                if(!readAttributes(cursor, m_member.attributes, m_member.attributesCount))
+                {
+                    return false;
+                }
+
+                if(m_stage == Stage::FIELD_ATTRIBUTES)
+                {
+                    m_fields.emplace_back(m_member.accessFlags, m_member.nameIndex, m_member.descriptorIndex, std::move(m_member.attributes));
+                    m_stage = Stage::FIELD_HEADER;
+                }
+                else
+                {
+                    m_methods.emplace_back(m_member.accessFlags, m_member.nameIndex, m_member.descriptorIndex, std::move(m_member.attributes));
+                    m_stage = Stage::METHOD_HEADER;
+                }
+                return true;
+            }
+            case Stage::ATTRIBUTES:
+            {
+                if(!readAttributes(cursor, m_attributes, m_attributesCount))
+                {
+                    return false;
+                }
+
+                m_stage = Stage::DONE;
+                m_state = State::COMPLETE;
+                return false;
+            }
+            case Stage::DONE:
+                return false;
+        }
+
+        return false;
+    }
+
+    bool ClassInfoParser::readAttributes(Stream::ByteCursor& cursor, std::pmr::vector<AttributeInfo>& attributes, std::size_t count)
+    {
+        while(m_attributesRead < count)
+        {
+            if(m_attributeSkip != 0)
+            {
+                const std::size_t skipped = std::min<std::size_t>(m_attributeSkip, cursor.remaining());
+                cursor.skip(skipped);
+                m_attributeSkip -= static_cast<u4>(skipped);
+                if(m_attributeSkip != 0)
+                {
+                    return false;
+                }
+
+                m_attributesRead++;
+                continue;
+            }
+
+            const std::size_t attributePosition = cursor.position();
+            if(!cursor.canRead(sizeof(u2) + sizeof(u4)))
+            {
+                return false;
+            }
+
+            const u2 attributeNameIndex = cursor.readUnchecked<u2>();
+            const u4 attributeInfoSize = cursor.readUnchecked<u4>();
+            if(!m_attributeFilter.keeps(m_constantPool, attributeNameIndex))
+            {
+                // Skipped on the next iteration, as far as the chunk reaches
+                m_attributeSkip = attributeInfoSize;
+                if(m_attributeSkip == 0)
+                {
+                    m_attributesRead++;
+                }
+                continue;
+            }
+
+            if(!cursor.canRead(attributeInfoSize))
+            {
+                cursor.seek(attributePosition);
+                return false;
+            }
+
+            // Chunks do not outlive the call to feed(), so the payload is copied
+            attributes.emplace_back(attributeNameIndex,
+                                    cursor.readBytes(attributeInfoSize),
+                                    attributes.get_allocator().resource(),
+                                    m_attributeKinds->resolve(attributeNameIndex));
+            m_attributesRead++;
+        }
+
+        return true;
+    }
+
+    bool ClassInfoParser::fail(Stream::ReadErrorCode code, std::size_t offset)
+    {
+        m_state = State::FAILED;
+        m_error = { code, m_pendingOffset + offset };
+
+        return false;
+    }
+} // namespace AeroJet::Java::ClassFile
@@ -0,0 +1,401 @@
+/*
+ * ClassReader.cpp
+ *
+ * Copyright © 2024 AeroJet Developers. All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the “Software”), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+ * OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "Java/ClassFile/ClassReader.hpp"
+
+#include "Exceptions/RuntimeException.hpp"
+
+#include <utility>
+
+namespace AeroJet::Java::ClassFile
+{
+    namespace
+    {
+        /**
+         * Unlike Stream::Reader::tryRead<AttributeInfo>, never copies the payload: events are synchronous, so
+         * visitors which keep an attribute of an unowned buffer are expected to copy it themselves.
+         */
+        Stream::ReadResult<AttributeInfo> readAttribute(Stream::ByteCursor& cursor, AttributeKindResolver& attributeKinds)
+        {
+            if(!cursor.canRead(sizeof(u2) + sizeof(u4)))
+            {
+                return Stream::readError(Stream::ReadErrorCode::UNEXPECTED_END, cursor.position());
+            }
+
+            const u2 attributeNameIndex = cursor.readUnchecked<u2>();
+            const u4 attributeInfoSize = cursor.readUnchecked<u4>();
+            if(!cursor.canRead(attributeInfoSize))
+            {
+                return Stream::readError(Stream::ReadErrorCode::UNEXPECTED_END, cursor.position());
+            }
+
+            return AttributeInfo{ attributeNameIndex,
+                                  cursor.readBytes(attributeInfoSize),
+                                  cursor.owner(),
+                                  attributeKinds.resolve(attributeNameIndex) };
+        }
+
+        /**
+         * @param offset offset of the index in the class bytes, reported when it does not name a valid UTF-8 entry
+         */
+        Stream::ReadResult<std::string_view> utf8(const ConstantPool& constantPool, u2 index, std::size_t offset)
+        {
+            if(!constantPool.contains(index))
+            {
+                return Stream::readError(Stream::ReadErrorCode::INVALID_CONSTANT_POOL_INDEX, offset);
+            }
+
+            try
+            {
+                // Entries of a lazy pool are only decoded, and thus validated, when first accessed
+                const ConstantPoolEntry& entry = constantPool.at(index);
+                if(entry.tag() != ConstantPoolInfoTag::UTF_8)
+                {
+                    return Stream::readError(Stream::ReadErrorCode::INVALID_CONSTANT_POOL_INDEX, offset);
+                }
+
+                return entry.as<ConstantPoolInfoUtf8>().rawString();
+            }
+            catch(const Exceptions::RuntimeException&)
+            {
+                return Stream::readError(Stream::ReadErrorCode::MALFORMED_MODIFIED_UTF8, offset);
+            }
+        }
+
+        /**
+         * Attributes read by readAttribute borrow their payload from bytes, preceded by the name index and the u4 length.
+         */
+        Stream::ReadResult<std::string_view> readAttributeName(const ConstantPool& constantPool,
+                                                               const AttributeInfo& attribute,
+                                                               std::span<const u1> bytes)
+        {
+            const std::size_t infoOffset = static_cast<std::size_t>(attribute.info().data() - bytes.data());
+            return utf8(constantPool, attribute.attributeNameIndex(), infoOffset - sizeof(u4) - sizeof(u2));
+        }
+
+        Stream::ReadError translate(Stream::ReadError error, std::size_t baseOffset)
+        {
+            error.offset += baseOffset;
+            return error;
+        }
+    } // namespace
+
+    ClassReader::ClassReader(std::span<const u1> bytes, std::shared_ptr<const void> owner) :
+        m_bytes(bytes), m_owner(std::move(owner))
+    {
+    }
+
+    std::optional<Stream::ReadError> ClassReader::accept(ClassVisitor& visitor) const
+    {
+        Stream::ByteCursor cursor{ m_bytes, m_owner };
+
+        // Lazy decoding keeps views into the class bytes, which only outlive accept() when they are owned
+        const ConstantPool::Decoding decoding = m_owner ? ConstantPool::Decoding::LAZY : ConstantPool::Decoding::EAGER;
+        Stream::ReadResult<ClassHeader> header = ClassHeader::tryRead(cursor, decoding);
+        if(!header)
+        {
+            return header.error();
+        }
+
+        const ConstantPool& constantPool = header->constantPool();
+        AttributeKindResolver attributeKinds{ constantPool };
+        Stream::ByteBuffer operands;
+        visitor.visitHeader(header.value());
+
+        if(!cursor.canRead(sizeof(u2)))
+        {
+            return Stream::ReadError{ Stream::ReadErrorCode::UNEXPECTED_END, cursor.position() };
+        }
+
+        const u2 fieldsCount = cursor.readUnchecked<u2>();
+        for(u2 fieldIndex = 0; fieldIndex < fieldsCount; fieldIndex++)
+        {
+            if(std::optional<Stream::ReadError> error = readField(cursor, attributeKinds, visitor))
+            {
+                return error;
+            }
+        }
+
+        if(!cursor.canRead(sizeof(u2)))
+        {
+            return Stream::ReadError{ Stream::ReadErrorCode::UNEXPECTED_END, cursor.position() };
+        }
+
+        const u2 methodsCount = cursor.readUnchecked<u2>();
+        for(u2 methodIndex = 0; methodIndex < methodsCount; methodIndex++)
+        {
+            if(std::optional<Stream::ReadError> error = readMethod(cursor, attributeKinds, operands, visitor))
+            {
+                return error;
+            }
+        }
+
+        if(!cursor.canRead(sizeof(u2)))
+        {
+            return Stream::ReadError{ Stream::ReadErrorCode::UNEXPECTED_END, cursor.position() };
+        }
+
+        const u2 attributesCount = cursor.readUnchecked<u2>();
+        for(u2 attributeIndex = 0; attributeIndex < attributesCount; attributeIndex++)
+        {
+            Stream::ReadResult<AttributeInfo> attribute = readAttribute(cursor, attributeKinds);
+            if(!attribute)
+            {
+                return attribute.error();
+            }
+
+            Stream::ReadResult<std::string_view> attributeName = readAttributeName(constantPool, attribute.value(), m_bytes);
+            if(!attributeName)
+            {
+                return attributeName.error();
+            }
+
+            visitor.visitAttribute(attributeName.value(), attribute.value());
+        }
+
+        visitor.visitEnd();
+        return std::nullopt;
+    }
+
+    std::optional<Stream::ReadError> ClassReader::readField(Stream::ByteCursor& cursor,
+                                                            AttributeKindResolver& attributeKinds,
+                                                            ClassVisitor& visitor) const
+    {
+        const ConstantPool& constantPool = attributeKinds.constantPool();
+        if(!cursor.canRead(sizeof(u2) * 4))
+        {
+            return Stream::ReadError{ Stream::ReadErrorCode::UNEXPECTED_END, cursor.position() };
+        }
+
+        const std::size_t nameIndexOffset = cursor.position() + sizeof(u2);
+        const u2 accessFlags = cursor.readUnchecked<u2>();
+        const u2 nameIndex = cursor.readUnchecked<u2>();
+        const u2 descriptorIndex = cursor.readUnchecked<u2>();
+        const u2 attributesCount = cursor.readUnchecked<u2>();
+
+        Stream::ReadResult<std::string_view> name = utf8(constantPool, nameIndex, nameIndexOffset);
+        if(!name)
+        {
+            return name.error();
+        }
+
+        Stream::ReadResult<std::string_view> descriptor = utf8(constantPool, descriptorIndex, nameIndexOffset + sizeof(u2));
+        if(!descriptor)
+        {
+            return descriptor.error();
+        }
+
+        FieldVisitor* fieldVisitor = visitor.visitField(accessFlags, name.value(), descriptor.value());
+
+        for(u2 attributeIndex = 0; attributeIndex < attributesCount; attributeIndex++)
+        {
+            Stream::ReadResult<AttributeInfo> attribute = readAttribute(cursor, attributeKinds);
+            if(!attribute)
+            {
+                return attribute.error();
+            }
+
+            if(!fieldVisitor)
+            {
+                continue;
+            }
+
+            Stream::ReadResult<std::string_view> attributeName = readAttributeName(constantPool, attribute.value(), m_bytes);
+            if(!attributeName)
+            {
+                return attributeName.error();
+            }
+
+            fieldVisitor->visitAttribute(attributeName.value(), attribute.value());
+        }
+
+        if(fieldVisitor)
+        {
+            fieldVisitor->visitEnd();
+        }
+
+        return std::nullopt;
+    }
+
+    std::optional<Stream::ReadError> ClassReader::readMethod(Stream::ByteCursor& cursor,
+                                                             AttributeKindResolver& attributeKinds,
+                                                             Stream::ByteBuffer& operands,
+                                                             ClassVisitor& visitor) const
+    {
+        const ConstantPool& constantPool = attributeKinds.constantPool();
+        if(!cursor.canRead(sizeof(u2) * 4))
+        {
+            return Stream::ReadError{ Stream::ReadErrorCode::UNEXPECTED_END, cursor.position() };
+        }
+
+        const std::size_t nameIndexOffset = cursor.position() + sizeof(u2);
+        const u2 accessFlags = cursor.readUnchecked<u2>();
+        const u2 nameIndex = cursor.readUnchecked<u2>();
+        const u2 descriptorIndex = cursor.readUnchecked<u2>();
+        const u2 attributesCount = cursor.readUnchecked<u2>();
+
+        Stream::ReadResult<std::string_view> name = utf8(constantPool, nameIndex, nameIndexOffset);
+        if(!name)
+        {
+            return name.error();
+        }
+
+        Stream::ReadResult<std::string_view> descriptor = utf8(constantPool, descriptorIndex, nameIndexOffset + sizeof(u2));
+        if(!descriptor)
+        {
+            return descriptor.error();
+        }
+
+        MethodVisitor* methodVisitor = visitor.visitMethod(accessFlags, name.value(), descriptor.value());
+
+        for(u2 attributeIndex = 0; attributeIndex < attributesCount; attributeIndex++)
+        {
+            Stream::ReadResult<AttributeInfo> attribute = readAttribute(cursor, attributeKinds);
+            if(!attribute)
+            {
+                return attribute.error();
+            }
+
+            if(!methodVisitor)
+            {
+                continue;
+            }
+
+            Stream::ReadResult<std::string_view> attributeName = readAttributeName(constantPool, attribute.value(), m_bytes);
+            if(!attributeName)
+            {
+                return attributeName.error();
+            }
+
+            if(attribute->kind() != AttributeKind::CODE)
+            {
+                methodVisitor->visitAttribute(attributeName.value(), attribute.value());
+                continue;
+            }
+
+            if(std::optional<Stream::ReadError> error = readCode(attribute.value(), attributeKinds, operands, *methodVisitor))
+            {
+                return error;
+            }
+        }
+
+        if(methodVisitor)
+        {
+            methodVisitor->visitEnd();
+        }
+
+        return std::nullopt;
+    }
+
+    std::optional<Stream::ReadError> ClassReader::readCode(const AttributeInfo& code,
+                                                           AttributeKindResolver& attributeKinds,
+                                                           Stream::ByteBuffer& operands,
+                                                           MethodVisitor& visitor) const
+    {
+        const ConstantPool& constantPool = attributeKinds.constantPool();
+
+        // Offsets inside the Code attribute are reported relative to the class bytes
+        const std::size_t infoOffset = static_cast<std::size_t>(code.info().data() - m_bytes.data());
+        Stream::ByteCursor cursor{ code.info(), m_owner };
+
+        if(!cursor.canRead(sizeof(u2) * 2 + sizeof(u4)))
+        {
+            return Stream::ReadError{ Stream::ReadErrorCode::UNEXPECTED_END, infoOffset + cursor.position() };
+        }
+
+        const u2 maxStack = cursor.readUnchecked<u2>();
+        const u2 maxLocals = cursor.readUnchecked<u2>();
+        const u4 codeLength = cursor.readUnchecked<u4>();
+        if(!cursor.canRead(codeLength))
+        {
+            return Stream::ReadError{ Stream::ReadErrorCode::UNEXPECTED_END, infoOffset + cursor.position() };
+        }
+
+        if(!visitor.visitCode(maxStack, maxLocals, codeLength))
+        {
+            return std::nullopt;
+        }
+
+        // Instruction decoding aligns switch padding to the beginning of the code, so it must see the whole info
+        const std::size_t codeBegin = cursor.position();
+        const std::size_t codeEnd = codeBegin + codeLength;
+        while(cursor.position() < codeEnd)
+        {
+            const u4 offset = static_cast<u4>(cursor.position() - codeBegin);
+            Stream::ReadResult<ByteCode::Instruction> instruction = ByteCode::Instruction::tryRead(cursor, operands);
+            if(!instruction)
+            {
+                return translate(instruction.error(), infoOffset);
+            }
+
+            visitor.visitInstruction(offset, instruction.value());
+        }
+
+        if(cursor.position() != codeEnd || !cursor.canRead(sizeof(u2)))
+        {
+            return Stream::ReadError{ Stream::ReadErrorCode::UNEXPECTED_END, infoOffset + cursor.position() };
+        }
+
+        const u2 exceptionTableLength = cursor.readUnchecked<u2>();
+        if(!cursor.canRead(sizeof(u2) * 4 * exceptionTableLength))
+        {
+            return Stream::ReadError{ Stream::ReadErrorCode::UNEXPECTED_END, infoOffset + cursor.position() };
+        }
+
+        for(u2 exceptionTableIndex = 0; exceptionTableIndex < exceptionTableLength; exceptionTableIndex++)
+        {
+            const u2 startPc = cursor.readUnchecked<u2>();
+            const u2 endPc = cursor.readUnchecked<u2>();
+            const u2 handlerPc = cursor.readUnchecked<u2>();
+            const u2 catchType = cursor.readUnchecked<u2>();
+
+            visitor.visitExceptionHandler(startPc, endPc, handlerPc, catchType);
+        }
+
+        if(!cursor.canRead(sizeof(u2)))
+        {
+            return Stream::ReadError{ Stream::ReadErrorCode::UNEXPECTED_END, infoOffset + cursor.position() };
+        }
+
+        const u2 attributesCount = cursor.readUnchecked<u2>();
+        for(u2 attributeIndex = 0; attributeIndex < attributesCount; attributeIndex++)
+        {
+            Stream::ReadResult<AttributeInfo> attribute = readAttribute(cursor, attributeKinds);
+            if(!attribute)
+            {
+                return translate(attribute.error(), infoOffset);
+            }
+
+            Stream::ReadResult<std::string_view> attributeName = readAttributeName(constantPool, attribute.value(), m_bytes);
+            if(!attributeName)
+            {
+                return attributeName.error();
+            }
+
+            visitor.visitCodeAttribute(attributeName.value(), attribute.value());
+        }
+
+        return std::nullopt;
+    }
+} // namespace AeroJet::Java::ClassFile
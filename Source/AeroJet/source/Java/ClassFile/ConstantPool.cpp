@@ -0,0 +1,496 @@
+/*
+ * ConstantPool.cpp
+ *
+ * Copyright © 2024 AeroJet Developers. All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the “Software”), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+ * OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "Java/ClassFile/ConstantPool.hpp"
+
+#include "fmt/format.h"
+#include "Stream/Reader.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+#include <system_error>
+#include <thread>
+
+namespace AeroJet::Java::ClassFile
+{
+    namespace
+    {
+        // Smaller pools are not worth the cost of waking up threads
+        constexpr std::size_t PARALLEL_CHUNK_SIZE = 4096;
+
+        /**
+         * Threads shared by parallel decodings, so that parsing many large classes does not start threads for each
+         * of them. Started on first use and joined at exit.
+         */
+        class DecodingWorkers
+        {
+          public:
+            [[nodiscard]] static DecodingWorkers& instance()
+            {
+                static DecodingWorkers workers;
+                return workers;
+            }
+
+            DecodingWorkers(const DecodingWorkers&) = delete;
+            DecodingWorkers& operator=(const DecodingWorkers&) = delete;
+
+            ~DecodingWorkers()
+            {
+                {
+                    std::lock_guard lock{ m_mutex };
+                    m_stopping = true;
+                }
+
+                m_wakeUp.notify_all();
+            }
+
+            /**
+             * @brief Calls task(0) on the calling thread and task(1) to task(count - 1) on idle workers
+             * The task must be able to complete the whole job alone: workers which are busy with other decodings or
+             * could not be started are not waited for, their indices are simply never run.
+             */
+            void run(std::size_t count, const std::function<void(std::size_t)>& task)
+            {
+                Job job{ &task, 1, count, 0 };
+                if(count > 1)
+                {
+                    std::lock_guard lock{ m_mutex };
+                    m_jobs.push_back(&job);
+                }
+
+                m_wakeUp.notify_all();
+                try
+                {
+                    task(0);
+                }
+                catch(...)
+                {
+                    finish(job);
+                    throw;
+                }
+
+                finish(job);
+            }
+
+          protected:
+            struct Job
+            {
+                const std::function<void(std::size_t)>* task;
+                std::size_t nextIndex;
+                std::size_t count;
+                std::size_t active;
+            };
+
+            DecodingWorkers()
+            {
+                const std::size_t threadsCount = std::max(1U, std::thread::hardware_concurrency()) - 1;
+                m_threads.reserve(threadsCount);
+                for(std::size_t threadIndex = 0; threadIndex < threadsCount; threadIndex++)
+                {
+                    try
+                    {
+                        m_threads.emplace_back([this]() { work(); });
+                    }
+                    catch(const std::system_error&)
+                    {
+                        // Fewer workers only make decoding slower
+                        break;
+                    }
+                }
+            }
+
+            /**
+             * Withdraws the job from idle workers and waits for the ones already running it
+             */
+            void finish(Job& job)
+            {
+                std::unique_lock lock{ m_mutex };
+                std::erase(m_jobs, &job);
+                m_jobDone.wait(lock, [&job]() { return job.active == 0; });
+            }
+
+            void work()
+            {
+                std::unique_lock lock{ m_mutex };
+                while(true)
+                {
+                    m_wakeUp.wait(lock, [this]() { return m_stopping || !m_jobs.empty(); });
+                    if(m_stopping)
+                    {
+                        return;
+                    }
+
+                    Job& job = *m_jobs.front();
+                    const std::size_t index = job.nextIndex++;
+                    if(job.nextIndex == job.count)
+                    {
+                        m_jobs.pop_front();
+                    }
+
+                    job.active++;
+                    lock.unlock();
+                    (*job.task)(index);
+                    lock.lock();
+
+                    if(--job.active == 0)
+                    {
+                        m_jobDone.notify_all();
+                    }
+                }
+            }
+
+            std::mutex m_mutex;
+            std::condition_variable m_wakeUp;
+            std::condition_variable m_jobDone;
+            std::deque<Job*> m_jobs;
+            bool m_stopping = false;
+
+            // Declared last, so that threads are joined before the state they use is destroyed
+            std::vector<std::jthread> m_threads;
+        };
+
+        /**
+         * Validates tags and lengths of the entries and records offset of every entry's tag, 0 for unusable slots
+         */
+        Stream::ReadResult<std::vector<u4>> scanOffsets(Stream::ByteCursor& cursor, u2 constantPoolCount)
+        {
+            std::vector<u4> offsets(constantPoolCount);
+            for(u4 index = 1; index < constantPoolCount; index++)
+            {
+                if(!cursor.canRead(sizeof(u1)))
+                {
+                    return Stream::readError(Stream::ReadErrorCode::UNEXPECTED_END, cursor.position());
+                }
+
+                offsets[index] = static_cast<u4>(cursor.position());
+                const ConstantPoolInfoTag tag = static_cast<ConstantPoolInfoTag>(cursor.readUnchecked<u1>());
+
+                std::size_t dataSize = ConstantPoolEntry::dataSize(tag);
+                if(tag == ConstantPoolInfoTag::UTF_8)
+                {
+                    if(!cursor.canRead(sizeof(u2)))
+                    {
+                        return Stream::readError(Stream::ReadErrorCode::UNEXPECTED_END, cursor.position());
+                    }
+
+                    dataSize = cursor.readUnchecked<u2>();
+                }
+                else if(dataSize == 0)
+                {
+                    return Stream::readError(Stream::ReadErrorCode::UNKNOWN_CONSTANT_POOL_TAG, cursor.position() - 1);
+                }
+
+                if(!cursor.canRead(dataSize))
+                {
+                    return Stream::readError(Stream::ReadErrorCode::UNEXPECTED_END, cursor.position());
+                }
+
+                cursor.skip(dataSize);
+
+                if(tag == ConstantPoolInfoTag::LONG || tag == ConstantPoolInfoTag::DOUBLE)
+                {
+                    index++;
+                }
+            }
+
+            return offsets;
+        }
+
+        std::size_t usableCount(const std::vector<u4>& offsets)
+        {
+            return offsets.size() - static_cast<std::size_t>(std::count(offsets.begin(), offsets.end(), 0));
+        }
+    } // namespace
+
+    struct ConstantPool::LazyEntries
+    {
+        LazyEntries(std::shared_ptr<const void> storage, std::span<const u1> bytes, std::vector<u4> offsets) :
+            storage(std::move(storage)), bytes(bytes), offsets(std::move(offsets)),
+            decoded(std::make_unique<std::atomic<bool>[]>(this->offsets.size())), entries(this->offsets.size())
+        {
+        }
+
+        const ConstantPoolEntry& at(u2 index)
+        {
+            if(!decoded[index].load(std::memory_order_acquire))
+            {
+                std::lock_guard lock{ mutex };
+                if(!decoded[index].load(std::memory_order_relaxed))
+                {
+                    Stream::ByteCursor cursor{ bytes };
+                    cursor.seek(offsets[index]);
+
+                    entries[index].emplace(Stream::Reader::read<ConstantPoolEntry>(cursor));
+                    decoded[index].store(true, std::memory_order_release);
+                }
+            }
+
+            return *entries[index];
+        }
+
+        std::shared_ptr<const void> storage;
+        std::span<const u1> bytes;
+
+        // Offset of the entry's tag within bytes, 0 for unusable slots
+        std::vector<u4> offsets;
+
+        std::unique_ptr<std::atomic<bool>[]> decoded;
+        std::vector<std::optional<ConstantPoolEntry>> entries;
+        std::mutex mutex;
+    };
+
+    ConstantPool::ConstantPool(std::pmr::memory_resource* memoryResource) :
+        m_slots(memoryResource)
+    {
+    }
+
+    Stream::ReadResult<ConstantPool> ConstantPool::tryRead(Stream::ByteCursor& cursor,
+                                                           u2 constantPoolCount,
+                                                           Decoding decoding,
+                                                           std::pmr::memory_resource* memoryResource)
+    {
+        ConstantPool constantPool{ memoryResource };
+
+        if(decoding == Decoding::LAZY && cursor.owner() != nullptr)
+        {
+            Stream::ReadResult<std::vector<u4>> offsets = scanOffsets(cursor, constantPoolCount);
+            if(!offsets)
+            {
+                return Unexpected{ offsets.error() };
+            }
+
+            constantPool.m_size = usableCount(*offsets);
+            constantPool.m_lazyEntries = std::make_shared<LazyEntries>(cursor.owner(), cursor.bytes(), std::move(offsets).value());
+            return constantPool;
+        }
+
+        if(decoding == Decoding::PARALLEL)
+        {
+            Stream::ReadResult<std::vector<u4>> offsets = scanOffsets(cursor, constantPoolCount);
+            if(!offsets)
+            {
+                return Unexpected{ offsets.error() };
+            }
+
+            if(std::optional<Stream::ReadError> error = constantPool.decodeParallel(cursor.bytes(), *offsets))
+            {
+                return Unexpected{ *error };
+            }
+
+            return constantPool;
+        }
+
+        constantPool.reserve(constantPoolCount);
+        for(u4 index = 1; index < constantPoolCount; index++)
+        {
+            Stream::ReadResult<ConstantPoolEntry> entry = Stream::Reader::tryRead<ConstantPoolEntry>(cursor);
+            if(!entry)
+            {
+                return Unexpected{ entry.error() };
+            }
+
+            const ConstantPoolInfoTag tag = entry->tag();
+            constantPool.insert({ static_cast<u2>(index), std::move(entry).value() });
+
+            if(tag == ConstantPoolInfoTag::LONG || tag == ConstantPoolInfoTag::DOUBLE)
+            {
+                index++;
+            }
+        }
+
+        return constantPool;
+    }
+
+    std::optional<Stream::ReadError> ConstantPool::decodeParallel(std::span<const u1> bytes, const std::vector<u4>& offsets)
+    {
+        m_slots.assign(offsets.size(), std::nullopt);
+        m_size = usableCount(offsets);
+
+        const std::size_t chunksCount = (offsets.size() + PARALLEL_CHUNK_SIZE - 1) / PARALLEL_CHUNK_SIZE;
+        const std::size_t threadsCount = std::min<std::size_t>(chunksCount, std::max(1U, std::thread::hardware_concurrency()));
+
+        std::atomic<std::size_t> nextChunk{ 0 };
+        std::vector<std::optional<Stream::ReadError>> errors(threadsCount);
+
+        // Every slot is written by exactly one thread. SymbolTable interning of UTF-8 entries is thread-safe.
+        const std::function<void(std::size_t)> decodeChunks = [&](std::size_t workerIndex)
+        {
+            Stream::ByteCursor cursor{ bytes };
+            for(std::size_t chunk = nextChunk++; chunk < chunksCount; chunk = nextChunk++)
+            {
+                const std::size_t chunkEnd = std::min(offsets.size(), (chunk + 1) * PARALLEL_CHUNK_SIZE);
+                for(std::size_t index = chunk * PARALLEL_CHUNK_SIZE; index < chunkEnd; index++)
+                {
+                    if(offsets[index] == 0)
+                    {
+                        continue;
+                    }
+
+                    cursor.seek(offsets[index]);
+                    Stream::ReadResult<ConstantPoolEntry> entry = Stream::Reader::tryRead<ConstantPoolEntry>(cursor);
+                    if(!entry)
+                    {
+                        std::optional<Stream::ReadError>& error = errors[workerIndex];
+                        if(!error.has_value() || entry.error().offset < error->offset)
+                        {
+                            error = entry.error();
+                        }
+                        break;
+                    }
+
+                    m_slots[index].emplace(std::move(entry).value());
+                }
+            }
+        };
+
+        DecodingWorkers::instance().run(threadsCount, decodeChunks);
+
+        // Report the error a sequential decoder would have stopped at
+        std::optional<Stream::ReadError> firstError;
+        for(const std::optional<Stream::ReadError>& error : errors)
+        {
+            if(error.has_value() && (!firstError.has_value() || error->offset < firstError->offset))
+            {
+                firstError = error;
+            }
+        }
+
+        return firstError;
+    }
+
+    void ConstantPool::reserve(u2 constantPoolCount)
+    {
+        m_slots.reserve(constantPoolCount);
+    }
+
+    void ConstantPool::insert(std::pair<u2, ConstantPoolEntry>&& indexedEntry)
+    {
+        materialize();
+
+        const u2 index = indexedEntry.first;
+        if(index >= m_slots.size())
+        {
+            m_slots.resize(static_cast<std::size_t>(index) + 1);
+        }
+
+        if(!m_slots[index].has_value())
+        {
+            m_size++;
+        }
+
+        m_slots[index].emplace(std::move(indexedEntry.second));
+    }
+
+    const ConstantPoolEntry& ConstantPool::at(u2 index) const
+    {
+        if(!contains(index))
+        {
+            throw std::out_of_range(fmt::format("Constant pool index {} does not refer to an entry", index));
+        }
+
+        if(m_lazyEntries != nullptr)
+        {
+            return m_lazyEntries->at(index);
+        }
+
+        return *m_slots[index];
+    }
+
+    bool ConstantPool::contains(u2 index) const
+    {
+        if(m_lazyEntries != nullptr)
+        {
+            return index < m_lazyEntries->offsets.size() && m_lazyEntries->offsets[index] != 0;
+        }
+
+        return index < m_slots.size() && m_slots[index].has_value();
+    }
+
+    SymbolId ConstantPool::symbol(u2 index) const
+    {
+        return at(index).as<ConstantPoolInfoUtf8>().symbol();
+    }
+
+    std::size_t ConstantPool::size() const
+    {
+        return m_size;
+    }
+
+    bool ConstantPool::isLazy() const
+    {
+        return m_lazyEntries != nullptr;
+    }
+
+    ConstantPool::const_iterator ConstantPool::begin() const
+    {
+        return { this, nextUsable(0) };
+    }
+
+    ConstantPool::const_iterator ConstantPool::end() const
+    {
+        return { this, slotCount() };
+    }
+
+    void ConstantPool::materialize()
+    {
+        if(m_lazyEntries == nullptr)
+        {
+            return;
+        }
+
+        // Decoding may throw on a malformed entry, the pool stays lazy until every entry is decoded
+        decltype(m_slots) slots(m_lazyEntries->offsets.size(), std::nullopt, m_slots.get_allocator());
+        for(std::size_t index = 0; index < slots.size(); index++)
+        {
+            if(m_lazyEntries->offsets[index] != 0)
+            {
+                slots[index].emplace(m_lazyEntries->at(static_cast<u2>(index)));
+            }
+        }
+
+        m_slots = std::move(slots);
+        m_lazyEntries.reset();
+    }
+
+    std::size_t ConstantPool::slotCount() const
+    {
+        return m_lazyEntries != nullptr ? m_lazyEntries->offsets.size() : m_slots.size();
+    }
+
+    std::size_t ConstantPool::nextUsable(std::size_t index) const
+    {
+        const std::size_t count = slotCount();
+        while(index < count && !contains(static_cast<u2>(index)))
+        {
+            index++;
+        }
+
+        return index;
+    }
+} // namespace AeroJet::Java::ClassFile
@@ -0,0 +1,405 @@
+/*
+ * ConstantPoolBuilder.cpp
+ *
+ * Copyright © 2024 AeroJet Developers. All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the “Software”), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+ * OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "Java/ClassFile/ConstantPoolBuilder.hpp"
+
+#include "Exceptions/RuntimeException.hpp"
+#include "fmt/format.h"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace AeroJet::Java::ClassFile
+{
+    namespace
+    {
+        bool isWide(ConstantPoolInfoTag tag)
+        {
+            return tag == ConstantPoolInfoTag::LONG || tag == ConstantPoolInfoTag::DOUBLE;
+        }
+
+        /**
+         * @brief Group of the entry in orderByFrequency(): constants loadable by ldc (§4.4), then other entries, then
+         * LONG and DOUBLE
+         */
+        int orderRank(ConstantPoolInfoTag tag)
+        {
+            switch(tag)
+            {
+                case ConstantPoolInfoTag::INTEGER:
+                case ConstantPoolInfoTag::FLOAT:
+                case ConstantPoolInfoTag::CLASS:
+                case ConstantPoolInfoTag::STRING:
+                case ConstantPoolInfoTag::METHOD_HANDLE:
+                case ConstantPoolInfoTag::METHOD_TYPE:
+                    return 0;
+                case ConstantPoolInfoTag::LONG:
+                case ConstantPoolInfoTag::DOUBLE:
+                    return 2;
+                default:
+                    return 1;
+            }
+        }
+
+        ConstantPoolEntry remapped(const ConstantPoolEntry& entry, const std::vector<u2>& indexMap)
+        {
+            const auto remap = [&indexMap](u2 index) -> u2
+            {
+                return index < indexMap.size() ? indexMap[index] : index;
+            };
+
+            const ConstantPoolInfoTag tag = entry.tag();
+            switch(tag)
+            {
+                case ConstantPoolInfoTag::CLASS:
+                    return ConstantPoolEntry::indices(tag, remap(entry.as<ConstantPoolInfoClass>().nameIndex()));
+                case ConstantPoolInfoTag::STRING:
+                    return ConstantPoolEntry::indices(tag, remap(entry.as<ConstantPoolInfoString>().stringIndex()));
+                case ConstantPoolInfoTag::METHOD_TYPE:
+                    return ConstantPoolEntry::indices(tag, remap(entry.as<ConstantPoolInfoMethodType>().descriptorIndex()));
+                case ConstantPoolInfoTag::FIELD_REF:
+                case ConstantPoolInfoTag::METHOD_REF:
+                case ConstantPoolInfoTag::INTERFACE_METHOD_REF:
+                {
+                    const ConstantPoolInfoFieldRef memberRef = entry.as<ConstantPoolInfoFieldRef>();
+                    return ConstantPoolEntry::indices(tag, remap(memberRef.classIndex()), remap(memberRef.nameAndTypeIndex()));
+                }
+                case ConstantPoolInfoTag::NAME_AND_TYPE:
+                {
+                    const ConstantPoolInfoNameAndType nameAndType = entry.as<ConstantPoolInfoNameAndType>();
+                    return ConstantPoolEntry::indices(tag, remap(nameAndType.nameIndex()), remap(nameAndType.descriptorIndex()));
+                }
+                case ConstantPoolInfoTag::METHOD_HANDLE:
+                {
+                    const ConstantPoolInfoMethodHandle methodHandle = entry.as<ConstantPoolInfoMethodHandle>();
+                    return ConstantPoolEntry::methodHandle(methodHandle.referenceKind(), remap(methodHandle.referenceIndex()));
+                }
+                case ConstantPoolInfoTag::INVOKE_DYNAMIC:
+                {
+                    // bootstrap_method_attr_index refers to the BootstrapMethods attribute, not to the pool
+                    const ConstantPoolInfoInvokeDynamic invokeDynamic = entry.as<ConstantPoolInfoInvokeDynamic>();
+                    return ConstantPoolEntry::indices(tag,
+                                                      invokeDynamic.bootstrapMethodAttributeIndex(),
+                                                      remap(invokeDynamic.nameAndTypeIndex()));
+                }
+                default:
+                    return entry;
+            }
+        }
+
+        void writeEntry(Stream::ByteBuffer& buffer, const ConstantPoolEntry& entry)
+        {
+            const ConstantPoolInfoTag tag = entry.tag();
+            buffer.write(static_cast<u1>(tag));
+
+            switch(tag)
+            {
+                case ConstantPoolInfoTag::UTF_8:
+                {
+                    const std::span<const u1> bytes = entry.as<ConstantPoolInfoUtf8>().rawBytes();
+                    buffer.write(static_cast<u2>(bytes.size()));
+                    buffer.append(bytes);
+                    break;
+                }
+                case ConstantPoolInfoTag::INTEGER:
+                case ConstantPoolInfoTag::FLOAT:
+                    buffer.write(entry.as<ConstantPoolInfoInteger>().bytes());
+                    break;
+                case ConstantPoolInfoTag::LONG:
+                case ConstantPoolInfoTag::DOUBLE:
+                {
+                    const ConstantPoolInfoLong wide = entry.as<ConstantPoolInfoLong>();
+                    buffer.write(wide.highBytes());
+                    buffer.write(wide.lowBytes());
+                    break;
+                }
+                case ConstantPoolInfoTag::CLASS:
+                    buffer.write(entry.as<ConstantPoolInfoClass>().nameIndex());
+                    break;
+                case ConstantPoolInfoTag::STRING:
+                    buffer.write(entry.as<ConstantPoolInfoString>().stringIndex());
+                    break;
+                case ConstantPoolInfoTag::METHOD_TYPE:
+                    buffer.write(entry.as<ConstantPoolInfoMethodType>().descriptorIndex());
+                    break;
+                case ConstantPoolInfoTag::FIELD_REF:
+                case ConstantPoolInfoTag::METHOD_REF:
+                case ConstantPoolInfoTag::INTERFACE_METHOD_REF:
+                {
+                    const ConstantPoolInfoFieldRef memberRef = entry.as<ConstantPoolInfoFieldRef>();
+                    buffer.write(memberRef.classIndex());
+                    buffer.write(memberRef.nameAndTypeIndex());
+                    break;
+                }
+                case ConstantPoolInfoTag::NAME_AND_TYPE:
+                {
+                    const ConstantPoolInfoNameAndType nameAndType = entry.as<ConstantPoolInfoNameAndType>();
+                    buffer.write(nameAndType.nameIndex());
+                    buffer.write(nameAndType.descriptorIndex());
+                    break;
+                }
+                case ConstantPoolInfoTag::METHOD_HANDLE:
+                {
+                    const ConstantPoolInfoMethodHandle methodHandle = entry.as<ConstantPoolInfoMethodHandle>();
+                    buffer.write(static_cast<u1>(methodHandle.referenceKind()));
+                    buffer.write(methodHandle.referenceIndex());
+                    break;
+                }
+                case ConstantPoolInfoTag::INVOKE_DYNAMIC:
+                {
+                    const ConstantPoolInfoInvokeDynamic invokeDynamic = entry.as<ConstantPoolInfoInvokeDynamic>();
+                    buffer.write(invokeDynamic.bootstrapMethodAttributeIndex());
+                    buffer.write(invokeDynamic.nameAndTypeIndex());
+                    break;
+                }
+                default:
+                    throw Exceptions::RuntimeException(
+                        fmt::format("Can't write constant pool entry with unknown tag {}", static_cast<u1>(tag)));
+            }
+        }
+    } // namespace
+
+    std::size_t ConstantPoolBuilder::KeyHash::operator()(const std::pair<ConstantPoolInfoTag, u8>& key) const
+    {
+        // Fibonacci hashing spreads sequential indices and symbol ids over the whole range
+        return static_cast<std::size_t>((key.second ^ (static_cast<u8>(key.first) << 56)) * 0x9E3779B97F4A7C15ULL);
+    }
+
+    ConstantPoolBuilder::ConstantPoolBuilder() :
+        m_slots(1), m_useCounts(1)
+    {
+    }
+
+    ConstantPoolBuilder::ConstantPoolBuilder(const ConstantPool& constantPool) :
+        m_slots(std::max<std::size_t>(constantPool.slotCount(), 1)), m_useCounts(m_slots.size())
+    {
+        m_indices.reserve(constantPool.size());
+        for(const auto& [index, entry] : constantPool)
+        {
+            m_slots[index].emplace(entry);
+            m_indices.try_emplace({ entry.tag(), entry.contentKey() }, index);
+        }
+    }
+
+    u2 ConstantPoolBuilder::add(const ConstantPoolEntry& entry)
+    {
+        const auto [iterator, inserted] = m_indices.try_emplace({ entry.tag(), entry.contentKey() }, 0);
+        if(inserted)
+        {
+            try
+            {
+                iterator->second = append(entry);
+            }
+            catch(...)
+            {
+                m_indices.erase(iterator);
+                throw;
+            }
+        }
+
+        m_useCounts[iterator->second]++;
+        return iterator->second;
+    }
+
+    u2 ConstantPoolBuilder::utf8(std::string_view string)
+    {
+        return add(ConstantPoolEntry::utf8({ reinterpret_cast<const u1*>(string.data()), string.size() }));
+    }
+
+    u2 ConstantPoolBuilder::classInfo(std::string_view name)
+    {
+        return add(ConstantPoolEntry::indices(ConstantPoolInfoTag::CLASS, utf8(name)));
+    }
+
+    u2 ConstantPoolBuilder::string(std::string_view value)
+    {
+        return add(ConstantPoolEntry::indices(ConstantPoolInfoTag::STRING, utf8(value)));
+    }
+
+    u2 ConstantPoolBuilder::nameAndType(std::string_view name, std::string_view descriptor)
+    {
+        const u2 nameIndex = utf8(name);
+        const u2 descriptorIndex = utf8(descriptor);
+
+        return add(ConstantPoolEntry::indices(ConstantPoolInfoTag::NAME_AND_TYPE, nameIndex, descriptorIndex));
+    }
+
+    u2 ConstantPoolBuilder::memberRef(ConstantPoolInfoTag tag,
+                                      std::string_view className,
+                                      std::string_view name,
+                                      std::string_view descriptor)
+    {
+        if(tag != ConstantPoolInfoTag::FIELD_REF && tag != ConstantPoolInfoTag::METHOD_REF &&
+           tag != ConstantPoolInfoTag::INTERFACE_METHOD_REF)
+        {
+            throw Exceptions::RuntimeException(fmt::format("Tag {} is not a member reference", static_cast<u1>(tag)));
+        }
+
+        const u2 classIndex = classInfo(className);
+        const u2 nameAndTypeIndex = nameAndType(name, descriptor);
+
+        return add(ConstantPoolEntry::indices(tag, classIndex, nameAndTypeIndex));
+    }
+
+    std::optional<u2> ConstantPoolBuilder::find(const ConstantPoolEntry& entry) const
+    {
+        const auto iterator = m_indices.find({ entry.tag(), entry.contentKey() });
+        if(iterator == m_indices.end())
+        {
+            return std::nullopt;
+        }
+
+        return iterator->second;
+    }
+
+    const ConstantPoolEntry& ConstantPoolBuilder::at(u2 index) const
+    {
+        if(index >= m_slots.size() || !m_slots[index].has_value())
+        {
+            throw std::out_of_range(fmt::format("Constant pool index {} does not refer to an entry", index));
+        }
+
+        return *m_slots[index];
+    }
+
+    u4 ConstantPoolBuilder::useCount(u2 index) const
+    {
+        static_cast<void>(at(index));
+        return m_useCounts[index];
+    }
+
+    u2 ConstantPoolBuilder::count() const
+    {
+        return static_cast<u2>(m_slots.size());
+    }
+
+    std::vector<u2> ConstantPoolBuilder::orderByFrequency()
+    {
+        std::vector<u2> order;
+        order.reserve(m_indices.size());
+        for(std::size_t index = 1; index < m_slots.size(); index++)
+        {
+            if(m_slots[index].has_value())
+            {
+                order.push_back(static_cast<u2>(index));
+            }
+        }
+
+        std::stable_sort(order.begin(),
+                         order.end(),
+                         [this](u2 first, u2 second)
+                         {
+                             const int firstRank = orderRank(m_slots[first]->tag());
+                             const int secondRank = orderRank(m_slots[second]->tag());
+                             if(firstRank != secondRank)
+                             {
+                                 return firstRank < secondRank;
+                             }
+
+                             return m_useCounts[first] > m_useCounts[second];
+                         });
+
+        std::vector<u2> indexMap(m_slots.size(), 0);
+        u2 nextIndex = 1;
+        for(const u2 index : order)
+        {
+            indexMap[index] = nextIndex;
+            nextIndex += isWide(m_slots[index]->tag()) ? 2 : 1;
+        }
+
+        std::vector<std::optional<ConstantPoolEntry>> slots(m_slots.size());
+        std::vector<u4> useCounts(m_slots.size());
+        for(const u2 index : order)
+        {
+            slots[indexMap[index]].emplace(remapped(*m_slots[index], indexMap));
+            useCounts[indexMap[index]] = m_useCounts[index];
+        }
+
+        m_slots = std::move(slots);
+        m_useCounts = std::move(useCounts);
+
+        // Keys of entries holding indices changed together with the indices
+        std::unordered_map<std::pair<ConstantPoolInfoTag, u8>, u2, KeyHash> indices;
+        indices.reserve(m_indices.size());
+        for(const auto& [key, index] : m_indices)
+        {
+            const ConstantPoolEntry& entry = *m_slots[indexMap[index]];
+            indices.try_emplace({ entry.tag(), entry.contentKey() }, indexMap[index]);
+        }
+        m_indices = std::move(indices);
+
+        return indexMap;
+    }
+
+    ConstantPool ConstantPoolBuilder::build() const
+    {
+        ConstantPool constantPool;
+        constantPool.reserve(count());
+
+        for(std::size_t index = 1; index < m_slots.size(); index++)
+        {
+            if(m_slots[index].has_value())
+            {
+                constantPool.insert({ static_cast<u2>(index), *m_slots[index] });
+            }
+        }
+
+        return constantPool;
+    }
+
+    void ConstantPoolBuilder::writeTo(Stream::ByteBuffer& buffer) const
+    {
+        buffer.write(count());
+
+        for(const auto& slot : m_slots)
+        {
+            if(slot.has_value())
+            {
+                writeEntry(buffer, *slot);
+            }
+        }
+    }
+
+    u2 ConstantPoolBuilder::append(const ConstantPoolEntry& entry)
+    {
+        const std::size_t width = isWide(entry.tag()) ? 2 : 1;
+        if(m_slots.size() + width > std::numeric_limits<u2>::max())
+        {
+            throw Exceptions::RuntimeException("Constant pool can't hold more than 65534 slots");
+        }
+
+        const u2 index = static_cast<u2>(m_slots.size());
+        m_slots.emplace_back(entry);
+        m_useCounts.push_back(0);
+
+        if(width == 2)
+        {
+            m_slots.emplace_back();
+            m_useCounts.push_back(0);
+        }
+
+        return index;
+    }
+} // namespace AeroJet::Java::ClassFile
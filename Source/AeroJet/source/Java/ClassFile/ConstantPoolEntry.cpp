@@ -24,45 +24,148 @@
 
 #include "Java/ClassFile/ConstantPoolEntry.hpp"
 
-#include "Exceptions/RuntimeException.hpp"
-#include "fmt/format.h"
+#include "Java/ClassFile/Utils/ModifiedUtf8Utils.hpp"
 #include "Stream/Reader.hpp"
-#include "Stream/StreamUtils.hpp"
-#include "Stream/Writer.hpp"
 
 namespace AeroJet::Java::ClassFile
 {
-    ConstantPoolEntry::ConstantPoolEntry(const ConstantPoolInfoTag tag, const std::vector<u1>& data) :
-        m_tag(tag), m_data(data)
+    ConstantPoolEntry::ConstantPoolEntry(const ConstantPoolInfoTag tag) :
+        m_tag(tag)
     {
     }
 
+    ConstantPoolEntry ConstantPoolEntry::utf8(std::span<const u1> bytes)
+    {
+        const Symbol symbol = SymbolTable::global().intern({ reinterpret_cast<const char*>(bytes.data()), bytes.size() });
+
+        ConstantPoolEntry entry{ ConstantPoolInfoTag::UTF_8 };
+        entry.m_utf8Length = static_cast<u2>(symbol.string.size());
+        entry.m_symbol = symbol.id;
+        entry.m_payload.utf8 = reinterpret_cast<const u1*>(symbol.string.data());
+
+        return entry;
+    }
+
+    ConstantPoolEntry ConstantPoolEntry::value(ConstantPoolInfoTag tag, u4 bytes)
+    {
+        ConstantPoolEntry entry{ tag };
+        entry.m_payload.value = bytes;
+
+        return entry;
+    }
+
+    ConstantPoolEntry ConstantPoolEntry::wideValue(ConstantPoolInfoTag tag, u4 highBytes, u4 lowBytes)
+    {
+        ConstantPoolEntry entry{ tag };
+        entry.m_payload.wide = { highBytes, lowBytes };
+
+        return entry;
+    }
+
+    ConstantPoolEntry ConstantPoolEntry::indices(ConstantPoolInfoTag tag, u2 firstIndex, u2 secondIndex)
+    {
+        ConstantPoolEntry entry{ tag };
+        entry.m_payload.indices = { firstIndex, secondIndex };
+
+        return entry;
+    }
+
+    ConstantPoolEntry ConstantPoolEntry::methodHandle(ConstantPoolInfoMethodHandle::ReferenceKind referenceKind,
+                                                      u2 referenceIndex)
+    {
+        return indices(ConstantPoolInfoTag::METHOD_HANDLE, static_cast<u2>(referenceKind), referenceIndex);
+    }
+
     ConstantPoolInfoTag ConstantPoolEntry::tag() const
     {
         return m_tag;
     }
 
-    const std::vector<u1>& ConstantPoolEntry::data() const
+    u8 ConstantPoolEntry::contentKey() const
     {
-        return m_data;
+        switch(m_tag)
+        {
+            case ConstantPoolInfoTag::UTF_8:
+                return m_symbol;
+            case ConstantPoolInfoTag::INTEGER:
+            case ConstantPoolInfoTag::FLOAT:
+                return m_payload.value;
+            case ConstantPoolInfoTag::LONG:
+            case ConstantPoolInfoTag::DOUBLE:
+                return (static_cast<u8>(m_payload.wide.high) << 32) | m_payload.wide.low;
+            default:
+                return (static_cast<u8>(m_payload.indices.first) << 16) | m_payload.indices.second;
+        }
     }
 
-    ConstantPoolInfoUtf8::ConstantPoolInfoUtf8(const std::vector<u1>& bytes) :
-        m_string(bytes.begin(), bytes.end()) {}
+    std::size_t ConstantPoolEntry::dataSize(ConstantPoolInfoTag tag)
+    {
+        switch(tag)
+        {
+            case ConstantPoolInfoTag::INTEGER:
+            case ConstantPoolInfoTag::FLOAT:
+                return sizeof(u4);
+            case ConstantPoolInfoTag::LONG:
+            case ConstantPoolInfoTag::DOUBLE:
+                return sizeof(u4) * 2;
+            case ConstantPoolInfoTag::CLASS:
+            case ConstantPoolInfoTag::STRING:
+            case ConstantPoolInfoTag::METHOD_TYPE:
+                return sizeof(u2);
+            case ConstantPoolInfoTag::FIELD_REF:
+            case ConstantPoolInfoTag::METHOD_REF:
+            case ConstantPoolInfoTag::INTERFACE_METHOD_REF:
+            case ConstantPoolInfoTag::NAME_AND_TYPE:
+            case ConstantPoolInfoTag::INVOKE_DYNAMIC:
+                return sizeof(u2) * 2;
+            case ConstantPoolInfoTag::METHOD_HANDLE:
+                return sizeof(u1) + sizeof(u2);
+            default:
+                return 0;
+        }
+    }
+
+    ConstantPoolInfoUtf8::ConstantPoolInfoUtf8(std::span<const u1> bytes, SymbolId symbol) :
+        m_bytes(bytes), m_symbol(symbol) {}
 
     u2 ConstantPoolInfoUtf8::length() const
     {
-        return m_string.size();
+        return m_bytes.size();
+    }
+
+    SymbolId ConstantPoolInfoUtf8::symbol() const
+    {
+        return m_symbol;
     }
 
     std::string ConstantPoolInfoUtf8::asString() const
     {
-        return m_string;
+        return Utils::ModifiedUtf8Utils::toUtf8(m_bytes);
+    }
+
+    std::string_view ConstantPoolInfoUtf8::asStringView(std::string& storage) const
+    {
+        return Utils::ModifiedUtf8Utils::toUtf8(m_bytes, storage);
+    }
+
+    std::u16string ConstantPoolInfoUtf8::asUtf16() const
+    {
+        return Utils::ModifiedUtf8Utils::toUtf16(m_bytes);
     }
 
     std::vector<u1> ConstantPoolInfoUtf8::bytes() const
     {
-        return std::vector<u1>{ m_string.begin(), m_string.end() };
+        return { m_bytes.begin(), m_bytes.end() };
+    }
+
+    std::span<const u1> ConstantPoolInfoUtf8::rawBytes() const
+    {
+        return m_bytes;
+    }
+
+    std::string_view ConstantPoolInfoUtf8::rawString() const
+    {
+        return { reinterpret_cast<const char*>(m_bytes.data()), m_bytes.size() };
     }
 
     ConstantPoolInfoInteger::ConstantPoolInfoInteger(u4 bytes) :
@@ -180,168 +283,160 @@ namespace AeroJet::Java::ClassFile
     template<>
     ConstantPoolInfoUtf8 ConstantPoolEntry::as() const
     {
-        return ConstantPoolInfoUtf8{ data() };
+        return ConstantPoolInfoUtf8{ std::span<const u1>{ m_payload.utf8, m_utf8Length }, m_symbol };
     }
 
     template<>
     ConstantPoolInfoInteger ConstantPoolEntry::as() const
     {
-        constexpr u2 BYTES_OFFSET = 0;
-        return ConstantPoolInfoInteger{ *(u4*)(&m_data[BYTES_OFFSET]) };
+        return ConstantPoolInfoInteger{ m_payload.value };
     }
 
     template<>
     ConstantPoolInfoLong ConstantPoolEntry::as() const
     {
-        constexpr u2 HIGH_BYTES_OFFSET = 0;
-        constexpr u2 LOW_BYTES_OFFSET = 4;
-
-        return ConstantPoolInfoLong{ *(u4*)(&m_data[HIGH_BYTES_OFFSET]), *(u4*)(&m_data[LOW_BYTES_OFFSET]) };
+        return ConstantPoolInfoLong{ m_payload.wide.high, m_payload.wide.low };
     }
 
     template<>
     ConstantPoolInfoClass ConstantPoolEntry::as() const
     {
-        constexpr u2 NAME_INDEX_OFFSET = 0;
-        return ConstantPoolInfoClass{ *(u2*)(&m_data[NAME_INDEX_OFFSET]) };
+        return ConstantPoolInfoClass{ m_payload.indices.first };
     }
 
     template<>
     ConstantPoolInfoString ConstantPoolEntry::as() const
     {
-        constexpr u2 STRING_INDEX_OFFSET = 0;
-        return ConstantPoolInfoString{ *(u2*)(&m_data[STRING_INDEX_OFFSET]) };
+        return ConstantPoolInfoString{ m_payload.indices.first };
     }
 
     template<>
     ConstantPoolInfoFieldRef ConstantPoolEntry::as() const
     {
-        constexpr u2 CLASS_INDEX_OFFSET = 0;
-        constexpr u2 NAME_AND_TYPE_INDEX_OFFSET = 2;
-
-        return ConstantPoolInfoFieldRef{ *(u2*)(&m_data[CLASS_INDEX_OFFSET]),
-                                         *(u2*)(&m_data[NAME_AND_TYPE_INDEX_OFFSET]) };
+        return ConstantPoolInfoFieldRef{ m_payload.indices.first, m_payload.indices.second };
     }
 
     template<>
     ConstantPoolInfoNameAndType ConstantPoolEntry::as() const
     {
-        constexpr u2 NAME_INDEX_OFFSET = 0;
-        constexpr u2 DESCRIPTOR_INDEX_OFFSET = 2;
-
-        return ConstantPoolInfoNameAndType{ *(u2*)(&m_data[NAME_INDEX_OFFSET]),
-                                            *(u2*)(&m_data[DESCRIPTOR_INDEX_OFFSET]) };
+        return ConstantPoolInfoNameAndType{ m_payload.indices.first, m_payload.indices.second };
     }
 
     template<>
     ConstantPoolInfoMethodHandle ConstantPoolEntry::as() const
     {
-        constexpr u2 REFERENCE_KIND_OFFSET = 0;
-        constexpr u2 REFERENCE_INDEX_OFFSET = 1;
-
-        return ConstantPoolInfoMethodHandle{ static_cast<ConstantPoolInfoMethodHandle::ReferenceKind>(
-                                                 *(u2*)(&m_data[REFERENCE_KIND_OFFSET])),
-                                             *(u2*)(&m_data[REFERENCE_INDEX_OFFSET]) };
+        return ConstantPoolInfoMethodHandle{
+            static_cast<ConstantPoolInfoMethodHandle::ReferenceKind>(m_payload.indices.first),
+            m_payload.indices.second
+        };
     }
 
     template<>
     ConstantPoolInfoMethodType ConstantPoolEntry::as() const
     {
-        constexpr u2 DESCRIPTOR_INDEX_OFFSET = 0;
-        return ConstantPoolInfoMethodType{ *(u2*)(&m_data[DESCRIPTOR_INDEX_OFFSET]) };
+        return ConstantPoolInfoMethodType{ m_payload.indices.first };
     }
 
     template<>
     ConstantPoolInfoInvokeDynamic ConstantPoolEntry::as() const
     {
-        constexpr u2 BOOTSTRAP_METHOD_ATTRIBUTE_INDEX_OFFSET = 0;
-        constexpr u2 NAME_AND_TYPE_INDEX_OFFSET = 2;
-
-        return ConstantPoolInfoInvokeDynamic{ *(u2*)(&m_data[BOOTSTRAP_METHOD_ATTRIBUTE_INDEX_OFFSET]),
-                                              *(u2*)(&m_data[NAME_AND_TYPE_INDEX_OFFSET]) };
+        return ConstantPoolInfoInvokeDynamic{ m_payload.indices.first, m_payload.indices.second };
     }
 } // namespace AeroJet::Java::ClassFile
 
 template<>
-AeroJet::Java::ClassFile::ConstantPoolEntry AeroJet::Stream::Reader::read(std::istream& stream, ByteOrder byteOrder)
+AeroJet::Stream::ReadResult<AeroJet::Java::ClassFile::ConstantPoolEntry> AeroJet::Stream::Reader::tryRead(ByteCursor& cursor)
 {
-    Stream::MemoryStream dataStream;
+    if(!cursor.canRead(sizeof(AeroJet::u1)))
+    {
+        return readError(ReadErrorCode::UNEXPECTED_END, cursor.position());
+    }
 
     const AeroJet::Java::ClassFile::ConstantPoolInfoTag tag =
-        static_cast<AeroJet::Java::ClassFile::ConstantPoolInfoTag>(
-            AeroJet::Stream::Reader::read<u1>(stream, byteOrder));
-    switch(tag)
+        static_cast<AeroJet::Java::ClassFile::ConstantPoolInfoTag>(cursor.readUnchecked<AeroJet::u1>());
+
+    if(tag == AeroJet::Java::ClassFile::ConstantPoolInfoTag::UTF_8)
     {
-        case Java::ClassFile::ConstantPoolInfoTag::UTF_8:
+        if(!cursor.canRead(sizeof(AeroJet::u2)))
+        {
+            return readError(ReadErrorCode::UNEXPECTED_END, cursor.position());
+        }
+
+        const AeroJet::u2 utf8Size = cursor.readUnchecked<AeroJet::u2>();
+        if(!cursor.canRead(utf8Size))
+        {
+            return readError(ReadErrorCode::UNEXPECTED_END, cursor.position());
+        }
+
+        const std::size_t bytesOffset = cursor.position();
+        const std::span<const AeroJet::u1> bytes = cursor.readBytes(utf8Size);
+        if(const std::optional<std::size_t> malformedOffset = AeroJet::Java::ClassFile::Utils::ModifiedUtf8Utils::validate(bytes))
         {
-            const AeroJet::u2 dataSize = AeroJet::Stream::Reader::read<AeroJet::u2>(stream, byteOrder);
-            for(AeroJet::u2 byteIndex = 0; byteIndex < dataSize; byteIndex++)
-            {
-                AeroJet::u1 byte = AeroJet::Stream::Reader::read<AeroJet::u1>(stream, byteOrder);
-                AeroJet::Stream::Writer::write(dataStream, byte);
-            }
-
-            break;
+            return readError(ReadErrorCode::MALFORMED_MODIFIED_UTF8, bytesOffset + *malformedOffset);
         }
+
+        return AeroJet::Java::ClassFile::ConstantPoolEntry::utf8(bytes);
+    }
+
+    const std::size_t dataSize = AeroJet::Java::ClassFile::ConstantPoolEntry::dataSize(tag);
+    if(dataSize == 0)
+    {
+        return readError(ReadErrorCode::UNKNOWN_CONSTANT_POOL_TAG, cursor.position() - 1);
+    }
+
+    if(!cursor.canRead(dataSize))
+    {
+        return readError(ReadErrorCode::UNEXPECTED_END, cursor.position());
+    }
+
+    switch(tag)
+    {
         case Java::ClassFile::ConstantPoolInfoTag::INTEGER:
         case Java::ClassFile::ConstantPoolInfoTag::FLOAT:
         {
-            const AeroJet::u4 value = AeroJet::Stream::Reader::read<AeroJet::u4>(stream, byteOrder);
-            AeroJet::Stream::Writer::write(dataStream, value);
-
-            break;
+            return AeroJet::Java::ClassFile::ConstantPoolEntry::value(tag, cursor.readUnchecked<AeroJet::u4>());
         }
         case Java::ClassFile::ConstantPoolInfoTag::LONG:
         case Java::ClassFile::ConstantPoolInfoTag::DOUBLE:
         {
-            const AeroJet::u4 highBytes = AeroJet::Stream::Reader::read<AeroJet::u4>(stream, byteOrder);
-            const AeroJet::u4 lowBytes = AeroJet::Stream::Reader::read<AeroJet::u4>(stream, byteOrder);
+            const AeroJet::u4 highBytes = cursor.readUnchecked<AeroJet::u4>();
+            const AeroJet::u4 lowBytes = cursor.readUnchecked<AeroJet::u4>();
 
-            AeroJet::Stream::Writer::write(dataStream, highBytes);
-            AeroJet::Stream::Writer::write(dataStream, lowBytes);
+            return AeroJet::Java::ClassFile::ConstantPoolEntry::wideValue(tag, highBytes, lowBytes);
+        }
+        case Java::ClassFile::ConstantPoolInfoTag::METHOD_HANDLE:
+        {
+            const AeroJet::u1 referenceKind = cursor.readUnchecked<AeroJet::u1>();
+            const AeroJet::u2 referenceIndex = cursor.readUnchecked<AeroJet::u2>();
 
-            break;
+            return AeroJet::Java::ClassFile::ConstantPoolEntry::methodHandle(
+                static_cast<AeroJet::Java::ClassFile::ConstantPoolInfoMethodHandle::ReferenceKind>(referenceKind),
+                referenceIndex);
         }
         case Java::ClassFile::ConstantPoolInfoTag::CLASS:
         case Java::ClassFile::ConstantPoolInfoTag::STRING:
         case Java::ClassFile::ConstantPoolInfoTag::METHOD_TYPE:
         {
-            const AeroJet::u2 index = AeroJet::Stream::Reader::read<AeroJet::u2>(stream, byteOrder);
-            AeroJet::Stream::Writer::write(dataStream, index);
-
-            break;
-        }
-        case Java::ClassFile::ConstantPoolInfoTag::FIELD_REF:
-        case Java::ClassFile::ConstantPoolInfoTag::METHOD_REF:
-        case Java::ClassFile::ConstantPoolInfoTag::INTERFACE_METHOD_REF:
-        case Java::ClassFile::ConstantPoolInfoTag::NAME_AND_TYPE:
-        case Java::ClassFile::ConstantPoolInfoTag::INVOKE_DYNAMIC:
-        {
-            const AeroJet::u2 index1 = AeroJet::Stream::Reader::read<AeroJet::u2>(stream, byteOrder);
-            const AeroJet::u2 index2 = AeroJet::Stream::Reader::read<AeroJet::u2>(stream, byteOrder);
-
-            AeroJet::Stream::Writer::write(dataStream, index1);
-            AeroJet::Stream::Writer::write(dataStream, index2);
-
-            break;
+            return AeroJet::Java::ClassFile::ConstantPoolEntry::indices(tag, cursor.readUnchecked<AeroJet::u2>());
         }
-        case Java::ClassFile::ConstantPoolInfoTag::METHOD_HANDLE:
+        default:
         {
-            const AeroJet::u1 referenceKind = AeroJet::Stream::Reader::read<AeroJet::u1>(stream, byteOrder);
-            const AeroJet::u2 referenceIndex = AeroJet::Stream::Reader::read<AeroJet::u2>(stream, byteOrder);
-
-            AeroJet::Stream::Writer::write(dataStream, referenceKind);
-            AeroJet::Stream::Writer::write(dataStream, referenceIndex);
+            const AeroJet::u2 firstIndex = cursor.readUnchecked<AeroJet::u2>();
+            const AeroJet::u2 secondIndex = cursor.readUnchecked<AeroJet::u2>();
 
-            break;
+            return AeroJet::Java::ClassFile::ConstantPoolEntry::indices(tag, firstIndex, secondIndex);
         }
-        default:
-            throw AeroJet::Exceptions::RuntimeException(
-                fmt::format("Unexpected Constant Pool Entry Tag {:#04x} at position {:#08x}!",
-                            static_cast<u2>(tag),
-                            static_cast<std::size_t>(stream.tellg())));
     }
+}
 
-    std::vector<AeroJet::u1> dataBytes = AeroJet::Stream::Utils::streamToBytes(dataStream);
-    return { tag, dataBytes };
+template<>
+AeroJet::Java::ClassFile::ConstantPoolEntry AeroJet::Stream::Reader::read(ByteCursor& cursor)
+{
+    return valueOrThrow(tryRead<AeroJet::Java::ClassFile::ConstantPoolEntry>(cursor));
+}
+
+template<>
+AeroJet::Java::ClassFile::ConstantPoolEntry AeroJet::Stream::Reader::read(std::istream& stream, ByteOrder /*byteOrder*/)
+{
+    return AeroJet::Stream::Reader::readBuffered<AeroJet::Java::ClassFile::ConstantPoolEntry>(stream);
 }
@@ -49,9 +49,9 @@ namespace AeroJet::Java::ClassFile
     FieldInfo::FieldInfo(u2 accessFlags,
                          u2 nameIndex,
                          u2 descriptorIndex,
-                         const std::vector<AttributeInfo>& attributes) :
+                         std::pmr::vector<AttributeInfo> attributes) :
         m_accessFlags(accessFlags),
-        m_nameIndex(nameIndex), m_descriptorIndex(descriptorIndex), m_attributes(attributes)
+        m_nameIndex(nameIndex), m_descriptorIndex(descriptorIndex), m_attributes(std::move(attributes)), m_attributeIndex(m_attributes)
     {
     }
 
@@ -70,27 +70,70 @@ namespace AeroJet::Java::ClassFile
         return m_descriptorIndex;
     }
 
-    const std::vector<AttributeInfo>& FieldInfo::attributes() const
+    AeroJet::Utils::TableView<AttributeInfo> FieldInfo::attributes() const
     {
         return m_attributes;
     }
+
+    const AttributeInfo* FieldInfo::findAttribute(AttributeKind kind) const
+    {
+        const std::optional<std::size_t> position = m_attributeIndex.find(kind);
+        return position.has_value() ? &m_attributes[position.value()] : nullptr;
+    }
+
+    Stream::ReadResult<FieldInfo> FieldInfo::tryRead(Stream::ByteCursor& cursor)
+    {
+        return tryRead(cursor, nullptr, AttributeFilter::all(), std::pmr::get_default_resource());
+    }
+
+    Stream::ReadResult<FieldInfo> FieldInfo::tryRead(Stream::ByteCursor& cursor,
+                                                     AttributeKindResolver& resolver,
+                                                     const AttributeFilter& attributeFilter,
+                                                     std::pmr::memory_resource* memoryResource)
+    {
+        return tryRead(cursor, &resolver, attributeFilter, memoryResource);
+    }
+
+    Stream::ReadResult<FieldInfo> FieldInfo::tryRead(Stream::ByteCursor& cursor,
+                                                     AttributeKindResolver* resolver,
+                                                     const AttributeFilter& attributeFilter,
+                                                     std::pmr::memory_resource* memoryResource)
+    {
+        if(!cursor.canRead(sizeof(u2) * 4))
+        {
+            return Stream::readError(Stream::ReadErrorCode::UNEXPECTED_END, cursor.position());
+        }
+
+        const u2 accessFlags = cursor.readUnchecked<u2>();
+        const u2 nameIndex = cursor.readUnchecked<u2>();
+        const u2 descriptorIndex = cursor.readUnchecked<u2>();
+        const u2 attributesCount = cursor.readUnchecked<u2>();
+
+        Stream::ReadResult<std::pmr::vector<AttributeInfo>> attributes =
+            attributeFilter.tryRead(cursor, attributesCount, resolver, memoryResource);
+        if(!attributes)
+        {
+            return Unexpected{ attributes.error() };
+        }
+
+        return FieldInfo{ accessFlags, nameIndex, descriptorIndex, std::move(attributes).value() };
+    }
 } // namespace AeroJet::Java::ClassFile
 
 template<>
-AeroJet::Java::ClassFile::FieldInfo AeroJet::Stream::Reader::read(std::istream& stream, ByteOrder byteOrder)
+AeroJet::Stream::ReadResult<AeroJet::Java::ClassFile::FieldInfo> AeroJet::Stream::Reader::tryRead(ByteCursor& cursor)
 {
-    const AeroJet::u2 accessFlags = AeroJet::Stream::Reader::read<AeroJet::u2>(stream, byteOrder);
-    const AeroJet::u2 nameIndex = AeroJet::Stream::Reader::read<AeroJet::u2>(stream, byteOrder);
-    const AeroJet::u2 descriptorIndex = AeroJet::Stream::Reader::read<AeroJet::u2>(stream, byteOrder);
-    const AeroJet::u2 attributesCount = AeroJet::Stream::Reader::read<AeroJet::u2>(stream, byteOrder);
-
-    std::vector<AeroJet::Java::ClassFile::AttributeInfo> attributes;
-    attributes.reserve(attributesCount);
-    for(AeroJet::u4 attributeIndex = 0; attributeIndex < attributesCount; attributeIndex++)
-    {
-        attributes.emplace_back(
-            AeroJet::Stream::Reader::read<AeroJet::Java::ClassFile::AttributeInfo>(stream, byteOrder));
-    }
+    return AeroJet::Java::ClassFile::FieldInfo::tryRead(cursor);
+}
 
-    return { accessFlags, nameIndex, descriptorIndex, attributes };
+template<>
+AeroJet::Java::ClassFile::FieldInfo AeroJet::Stream::Reader::read(ByteCursor& cursor)
+{
+    return valueOrThrow(tryRead<AeroJet::Java::ClassFile::FieldInfo>(cursor));
+}
+
+template<>
+AeroJet::Java::ClassFile::FieldInfo AeroJet::Stream::Reader::read(std::istream& stream, ByteOrder /*byteOrder*/)
+{
+    return AeroJet::Stream::Reader::readBuffered<AeroJet::Java::ClassFile::FieldInfo>(stream);
 }
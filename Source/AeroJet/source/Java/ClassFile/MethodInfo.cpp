@@ -24,19 +24,112 @@
 
 #include "Java/ClassFile/MethodInfo.hpp"
 
+#include "Java/ClassFile/Attributes/Code.hpp"
+#include "Java/ClassFile/Attributes/LineNumberTable.hpp"
+#include "Java/ClassFile/Attributes/StackMapTable.hpp"
+
 #include "Stream/Reader.hpp"
 
+#include <memory>
+#include <mutex>
+#include <optional>
+
 namespace AeroJet::Java::ClassFile
 {
+    /**
+     * Attributes decoded on demand. Each one is guarded by its own flag, so that decoding the code does not wait
+     * for a concurrent decoding of its line numbers and vice versa.
+     */
+    struct MethodInfo::DecodedAttributes
+    {
+        std::once_flag codeFlag;
+        std::optional<Code> code;
+
+        std::once_flag stackMapTableFlag;
+        std::optional<StackMapTable> stackMapTable;
+
+        std::once_flag lineNumberTableFlag;
+        std::optional<LineNumberTable> lineNumberTable;
+    };
+
     MethodInfo::MethodInfo(u2 accessFlags,
                            u2 nameIndex,
                            u2 descriptorIndex,
-                           const std::vector<AttributeInfo>& attributes) :
+                           std::pmr::vector<AttributeInfo> attributes) :
         m_accessFlags(accessFlags),
-        m_nameIndex(nameIndex), m_descriptorIndex(descriptorIndex), m_attributes(attributes)
+        m_nameIndex(nameIndex), m_descriptorIndex(descriptorIndex), m_attributes(std::move(attributes)), m_attributeIndex(m_attributes),
+        m_decodedAttributes(nullptr)
+    {
+    }
+
+    MethodInfo::MethodInfo(const MethodInfo& other) :
+        m_accessFlags(other.m_accessFlags),
+        m_nameIndex(other.m_nameIndex), m_descriptorIndex(other.m_descriptorIndex), m_attributes(other.m_attributes),
+        m_attributeIndex(other.m_attributeIndex), m_decodedAttributes(nullptr)
     {
     }
 
+    MethodInfo::MethodInfo(MethodInfo&& other) noexcept :
+        m_accessFlags(other.m_accessFlags),
+        m_nameIndex(other.m_nameIndex), m_descriptorIndex(other.m_descriptorIndex), m_attributes(std::move(other.m_attributes)),
+        m_attributeIndex(other.m_attributeIndex), m_decodedAttributes(other.m_decodedAttributes.exchange(nullptr, std::memory_order_acq_rel))
+    {
+    }
+
+    MethodInfo& MethodInfo::operator=(const MethodInfo& other)
+    {
+        if(this != &other)
+        {
+            m_accessFlags = other.m_accessFlags;
+            m_nameIndex = other.m_nameIndex;
+            m_descriptorIndex = other.m_descriptorIndex;
+            m_attributes = other.m_attributes;
+            m_attributeIndex = other.m_attributeIndex;
+            delete m_decodedAttributes.exchange(nullptr, std::memory_order_acq_rel);
+        }
+
+        return *this;
+    }
+
+    MethodInfo& MethodInfo::operator=(MethodInfo&& other) noexcept
+    {
+        if(this != &other)
+        {
+            m_accessFlags = other.m_accessFlags;
+            m_nameIndex = other.m_nameIndex;
+            m_descriptorIndex = other.m_descriptorIndex;
+            m_attributes = std::move(other.m_attributes);
+            m_attributeIndex = other.m_attributeIndex;
+            delete m_decodedAttributes.exchange(other.m_decodedAttributes.exchange(nullptr, std::memory_order_acq_rel),
+                                                std::memory_order_acq_rel);
+        }
+
+        return *this;
+    }
+
+    MethodInfo::~MethodInfo()
+    {
+        delete m_decodedAttributes.load(std::memory_order_acquire);
+    }
+
+    MethodInfo::DecodedAttributes& MethodInfo::decodedAttributes() const
+    {
+        if(DecodedAttributes* decoded = m_decodedAttributes.load(std::memory_order_acquire))
+        {
+            return *decoded;
+        }
+
+        // Racing threads may both allocate, only the first published instance is kept
+        auto created = std::make_unique<DecodedAttributes>();
+        DecodedAttributes* expected = nullptr;
+        if(m_decodedAttributes.compare_exchange_strong(expected, created.get(), std::memory_order_acq_rel, std::memory_order_acquire))
+        {
+            return *created.release();
+        }
+
+        return *expected;
+    }
+
     MethodInfo::AccessFlags MethodInfo::accessFlags() const
     {
         return static_cast<AccessFlags>(m_accessFlags);
@@ -52,27 +145,146 @@ namespace AeroJet::Java::ClassFile
         return m_descriptorIndex;
     }
 
-    const std::vector<AttributeInfo>& MethodInfo::attributes() const
+    AeroJet::Utils::TableView<AttributeInfo> MethodInfo::attributes() const
     {
         return m_attributes;
     }
+
+    const AttributeInfo* MethodInfo::findAttribute(AttributeKind kind) const
+    {
+        const std::optional<std::size_t> position = m_attributeIndex.find(kind);
+        return position.has_value() ? &m_attributes[position.value()] : nullptr;
+    }
+
+    const Code* MethodInfo::code(const ConstantPool& constantPool) const
+    {
+        DecodedAttributes& decoded = decodedAttributes();
+        const auto decodeCode = [&]()
+        {
+            const AttributeInfo* codeInfo = findAttribute(AttributeKind::CODE);
+            if(codeInfo == nullptr)
+            {
+                // Attributes read without a constant pool have no kind, their names may be anything
+                AttributeKindResolver resolver = AttributeKindResolver::uncached(constantPool);
+                for(const AttributeInfo& attribute : m_attributes)
+                {
+                    if(attribute.kind() == AttributeKind::UNKNOWN &&
+                       resolver.resolve(attribute.attributeNameIndex()) == AttributeKind::CODE)
+                    {
+                        codeInfo = &attribute;
+                        break;
+                    }
+                }
+            }
+
+            if(codeInfo != nullptr)
+            {
+                decoded.code.emplace(constantPool, *codeInfo);
+            }
+        };
+
+        std::call_once(decoded.codeFlag, decodeCode);
+
+        return decoded.code.has_value() ? &decoded.code.value() : nullptr;
+    }
+
+    const StackMapTable* MethodInfo::stackMapTable(const ConstantPool& constantPool) const
+    {
+        const Code* methodCode = code(constantPool);
+        if(methodCode == nullptr)
+        {
+            return nullptr;
+        }
+
+        DecodedAttributes& decoded = decodedAttributes();
+        const auto decodeStackMapTable = [&]()
+        {
+            if(const AttributeInfo* attribute = methodCode->findAttribute(AttributeKind::STACK_MAP_TABLE))
+            {
+                decoded.stackMapTable.emplace(constantPool, *attribute);
+            }
+        };
+
+        std::call_once(decoded.stackMapTableFlag, decodeStackMapTable);
+
+        return decoded.stackMapTable.has_value() ? &decoded.stackMapTable.value() : nullptr;
+    }
+
+    const LineNumberTable* MethodInfo::lineNumberTable(const ConstantPool& constantPool) const
+    {
+        const Code* methodCode = code(constantPool);
+        if(methodCode == nullptr)
+        {
+            return nullptr;
+        }
+
+        DecodedAttributes& decoded = decodedAttributes();
+        const auto decodeLineNumberTable = [&]()
+        {
+            if(const AttributeInfo* attribute = methodCode->findAttribute(AttributeKind::LINE_NUMBER_TABLE))
+            {
+                decoded.lineNumberTable.emplace(constantPool, *attribute);
+            }
+        };
+
+        std::call_once(decoded.lineNumberTableFlag, decodeLineNumberTable);
+
+        return decoded.lineNumberTable.has_value() ? &decoded.lineNumberTable.value() : nullptr;
+    }
+
+    Stream::ReadResult<MethodInfo> MethodInfo::tryRead(Stream::ByteCursor& cursor)
+    {
+        return tryRead(cursor, nullptr, AttributeFilter::all(), std::pmr::get_default_resource());
+    }
+
+    Stream::ReadResult<MethodInfo> MethodInfo::tryRead(Stream::ByteCursor& cursor,
+                                                       AttributeKindResolver& resolver,
+                                                       const AttributeFilter& attributeFilter,
+                                                       std::pmr::memory_resource* memoryResource)
+    {
+        return tryRead(cursor, &resolver, attributeFilter, memoryResource);
+    }
+
+    Stream::ReadResult<MethodInfo> MethodInfo::tryRead(Stream::ByteCursor& cursor,
+                                                       AttributeKindResolver* resolver,
+                                                       const AttributeFilter& attributeFilter,
+                                                       std::pmr::memory_resource* memoryResource)
+    {
+        if(!cursor.canRead(sizeof(u2) * 4))
+        {
+            return Stream::readError(Stream::ReadErrorCode::UNEXPECTED_END, cursor.position());
+        }
+
+        const u2 accessFlags = cursor.readUnchecked<u2>();
+        const u2 nameIndex = cursor.readUnchecked<u2>();
+        const u2 descriptorIndex = cursor.readUnchecked<u2>();
+        const u2 attributesCount = cursor.readUnchecked<u2>();
+
+        Stream::ReadResult<std::pmr::vector<AttributeInfo>> attributes =
+            attributeFilter.tryRead(cursor, attributesCount, resolver, memoryResource);
+        if(!attributes)
+        {
+            return Unexpected{ attributes.error() };
+        }
+
+        return MethodInfo{ accessFlags, nameIndex, descriptorIndex, std::move(attributes).value() };
+    }
 } // namespace AeroJet::Java::ClassFile
 
 template<>
-AeroJet::Java::ClassFile::MethodInfo AeroJet::Stream::Reader::read(std::istream& stream, ByteOrder byteOrder)
+AeroJet::Stream::ReadResult<AeroJet::Java::ClassFile::MethodInfo> AeroJet::Stream::Reader::tryRead(ByteCursor& cursor)
 {
-    const AeroJet::u2 accessFlags = read<AeroJet::u2>(stream, byteOrder);
-    const AeroJet::u2 nameIndex = read<AeroJet::u2>(stream, byteOrder);
-    const AeroJet::u2 descriptorIndex = read<AeroJet::u2>(stream, byteOrder);
-    const AeroJet::u2 attributesCount = read<AeroJet::u2>(stream, byteOrder);
+    return AeroJet::Java::ClassFile::MethodInfo::tryRead(cursor);
+}
 
-    std::vector<AeroJet::Java::ClassFile::AttributeInfo> attributes;
-    attributes.reserve(attributesCount);
-    for(int32_t attributeIndex = 0; attributeIndex < attributesCount; attributeIndex++)
-    {
-        attributes.emplace_back(
-            AeroJet::Stream::Reader::read<AeroJet::Java::ClassFile::AttributeInfo>(stream, byteOrder));
-    }
+template<>
+AeroJet::Java::ClassFile::MethodInfo AeroJet::Stream::Reader::read(ByteCursor& cursor)
+{
+    return valueOrThrow(tryRead<AeroJet::Java::ClassFile::MethodInfo>(cursor));
+}
 
-    return { accessFlags, nameIndex, descriptorIndex, attributes };
+template<>
+AeroJet::Java::ClassFile::MethodInfo AeroJet::Stream::Reader::read(std::istream& stream, ByteOrder /*byteOrder*/)
+{
+    return AeroJet::Stream::Reader::readBuffered<AeroJet::Java::ClassFile::MethodInfo>(stream);
 }
@@ -0,0 +1,100 @@
+/*
+ * ParserContext.cpp
+ *
+ * Copyright © 2024 AeroJet Developers. All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the “Software”), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+ * OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "Java/ClassFile/ParserContext.hpp"
+
+#include "Stream/Reader.hpp"
+
+#include <iterator>
+#include <utility>
+
+namespace AeroJet::Java::ClassFile
+{
+    namespace
+    {
+        // Slot arrays of huge constant pools should be pooled as well
+        constexpr std::size_t LARGEST_POOLED_BLOCK = 1 << 20;
+    } // namespace
+
+    ParserContext::ParserContext(std::pmr::memory_resource* upstream) :
+        m_pool(std::make_shared<std::pmr::synchronized_pool_resource>(std::pmr::pool_options{ 0, LARGEST_POOLED_BLOCK }, upstream)),
+        m_buffer(std::make_shared<Buffer>(Buffer{ {}, m_pool }))
+    {
+    }
+
+    ParserContext& ParserContext::local()
+    {
+        thread_local ParserContext context;
+        return context;
+    }
+
+    std::vector<u1>& ParserContext::buffer()
+    {
+        // Classes parsed from the buffer borrow from it, so it may only be reused once all of them are gone
+        if(m_buffer.use_count() > 1)
+        {
+            m_buffer = std::make_shared<Buffer>(Buffer{ {}, m_pool });
+        }
+
+        return m_buffer->bytes;
+    }
+
+    Stream::ReadResult<ClassInfo> ParserContext::tryParse(ConstantPool::Decoding decoding)
+    {
+        const std::span<const u1> bytes{ m_buffer->bytes };
+        return ClassInfo::tryLoad(m_buffer, bytes, decoding, m_pool.get(), m_attributeFilter);
+    }
+
+    Stream::ReadResult<ClassInfo> ParserContext::tryParse(std::span<const u1> bytes, ConstantPool::Decoding decoding)
+    {
+        buffer().assign(bytes.begin(), bytes.end());
+        return tryParse(decoding);
+    }
+
+    Stream::ReadResult<ClassInfo> ParserContext::tryParse(std::istream& stream, ConstantPool::Decoding decoding)
+    {
+        buffer().assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+        return tryParse(decoding);
+    }
+
+    ClassInfo ParserContext::parse(ConstantPool::Decoding decoding)
+    {
+        return Stream::Reader::valueOrThrow(tryParse(decoding));
+    }
+
+    std::pmr::memory_resource* ParserContext::memoryResource()
+    {
+        return m_pool.get();
+    }
+
+    void ParserContext::setAttributeFilter(AttributeFilter attributeFilter)
+    {
+        m_attributeFilter = std::move(attributeFilter);
+    }
+
+    const AttributeFilter& ParserContext::attributeFilter() const
+    {
+        return m_attributeFilter;
+    }
+} // namespace AeroJet::Java::ClassFile
@@ -0,0 +1,171 @@
+/*
+ * ResolutionCache.cpp
+ *
+ * Copyright © 2024 AeroJet Developers. All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the “Software”), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+ * OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "Java/ClassFile/ResolutionCache.hpp"
+
+#include "Exceptions/RuntimeException.hpp"
+#include "fmt/format.h"
+
+#include <stdexcept>
+#include <string>
+
+namespace AeroJet::Java::ClassFile
+{
+    ResolutionCache::ResolutionCache(std::size_t slotCount) :
+        m_slotCount(slotCount), m_resolved(std::make_unique<std::atomic<const ResolvedReference*>[]>(slotCount))
+    {
+    }
+
+    const ResolvedReference& ResolutionCache::resolve(const ConstantPool& constantPool, u2 index)
+    {
+        if(index >= m_slotCount)
+        {
+            throw std::out_of_range(fmt::format("Constant pool index {} does not refer to an entry", index));
+        }
+
+        if(const ResolvedReference* resolved = m_resolved[index].load(std::memory_order_acquire))
+        {
+            return *resolved;
+        }
+
+        // Resolved outside of the lock, racing threads compute the same value and the first one is published
+        ResolvedReference reference = resolveUncached(constantPool, index);
+
+        std::lock_guard lock{ m_mutex };
+        if(const ResolvedReference* resolved = m_resolved[index].load(std::memory_order_relaxed))
+        {
+            return *resolved;
+        }
+
+        const ResolvedReference& stored = m_references.emplace_back(std::move(reference));
+        m_resolved[index].store(&stored, std::memory_order_release);
+
+        return stored;
+    }
+
+    ResolvedReference ResolutionCache::resolveUncached(const ConstantPool& constantPool, u2 index)
+    {
+        const ConstantPoolEntry& entry = constantPool.at(index);
+        switch(entry.tag())
+        {
+            case ConstantPoolInfoTag::CLASS:
+            {
+                return { ConstantPoolInfoTag::CLASS, utf8Symbol(constantPool, entry.as<ConstantPoolInfoClass>().nameIndex()) };
+            }
+            case ConstantPoolInfoTag::NAME_AND_TYPE:
+            {
+                const ConstantPoolInfoNameAndType nameAndType = entry.as<ConstantPoolInfoNameAndType>();
+
+                ResolvedReference reference{ ConstantPoolInfoTag::NAME_AND_TYPE };
+                reference.name = utf8Symbol(constantPool, nameAndType.nameIndex());
+                reference.descriptor = utf8Symbol(constantPool, nameAndType.descriptorIndex());
+
+                std::string descriptor{ reference.descriptor.string };
+                if(descriptor.starts_with(MethodDescriptor::METHOD_DESCRIPTOR_ARGS_BEGIN_TOKEN))
+                {
+                    reference.parsedDescriptor.emplace<MethodDescriptor>(std::move(descriptor));
+                }
+                else
+                {
+                    reference.parsedDescriptor.emplace<FieldDescriptor>(std::move(descriptor));
+                }
+
+                return reference;
+            }
+            case ConstantPoolInfoTag::FIELD_REF:
+            case ConstantPoolInfoTag::METHOD_REF:
+            case ConstantPoolInfoTag::INTERFACE_METHOD_REF:
+            {
+                const ConstantPoolInfoFieldRef memberRef = entry.as<ConstantPoolInfoFieldRef>();
+
+                static_cast<void>(referencedEntry(constantPool, memberRef.classIndex(), ConstantPoolInfoTag::CLASS));
+                static_cast<void>(referencedEntry(constantPool, memberRef.nameAndTypeIndex(), ConstantPoolInfoTag::NAME_AND_TYPE));
+
+                // Owner class and name-and-type are shared by many references, so they are memoized as well
+                ResolvedReference reference = resolve(constantPool, memberRef.nameAndTypeIndex());
+                reference.tag = entry.tag();
+                reference.className = resolve(constantPool, memberRef.classIndex()).className;
+
+                return reference;
+            }
+            default:
+                throw Exceptions::RuntimeException(
+                    fmt::format("Constant pool entry {} is not a symbolic reference (tag {})", index, static_cast<u1>(entry.tag())));
+        }
+    }
+
+    LazyResolutionCache::LazyResolutionCache(const LazyResolutionCache& other) :
+        m_cache(std::atomic_load_explicit(&other.m_cache, std::memory_order_acquire))
+    {
+    }
+
+    LazyResolutionCache& LazyResolutionCache::operator=(const LazyResolutionCache& other)
+    {
+        if(this != &other)
+        {
+            std::atomic_store_explicit(
+                &m_cache, std::atomic_load_explicit(&other.m_cache, std::memory_order_acquire), std::memory_order_release);
+        }
+
+        return *this;
+    }
+
+    const ResolvedReference& LazyResolutionCache::resolve(const ConstantPool& constantPool, u2 index) const
+    {
+        std::shared_ptr<ResolutionCache> cache = std::atomic_load_explicit(&m_cache, std::memory_order_acquire);
+        if(!cache)
+        {
+            // Racing threads may both allocate, only the first published cache is kept
+            std::shared_ptr<ResolutionCache> created = std::make_shared<ResolutionCache>(constantPool.slotCount());
+            if(std::atomic_compare_exchange_strong_explicit(
+                   &m_cache, &cache, created, std::memory_order_acq_rel, std::memory_order_acquire))
+            {
+                cache = std::move(created);
+            }
+        }
+
+        // The cache is kept alive by m_cache, so the returned reference outlives the local handle
+        return cache->resolve(constantPool, index);
+    }
+
+    const ConstantPoolEntry& ResolutionCache::referencedEntry(const ConstantPool& constantPool, u2 index, ConstantPoolInfoTag tag)
+    {
+        const ConstantPoolEntry& entry = constantPool.at(index);
+        if(entry.tag() != tag)
+        {
+            throw Exceptions::RuntimeException(fmt::format("Constant pool entry {} has tag {} while {} is expected",
+                                                           index,
+                                                           static_cast<u1>(entry.tag()),
+                                                           static_cast<u1>(tag)));
+        }
+
+        return entry;
+    }
+
+    Symbol ResolutionCache::utf8Symbol(const ConstantPool& constantPool, u2 index)
+    {
+        const SymbolId id = referencedEntry(constantPool, index, ConstantPoolInfoTag::UTF_8).as<ConstantPoolInfoUtf8>().symbol();
+        return { id, SymbolTable::global().symbol(id) };
+    }
+} // namespace AeroJet::Java::ClassFile
@@ -0,0 +1,114 @@
+/*
+ * SymbolTable.cpp
+ *
+ * Copyright © 2024 AeroJet Developers. All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the “Software”), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+ * OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "Java/ClassFile/SymbolTable.hpp"
+
+#include "Exceptions/RuntimeException.hpp"
+#include "fmt/format.h"
+
+#include <functional>
+#include <mutex>
+
+namespace AeroJet::Java::ClassFile
+{
+    SymbolTable& SymbolTable::global()
+    {
+        static SymbolTable symbolTable;
+        return symbolTable;
+    }
+
+    Symbol SymbolTable::intern(std::string_view string)
+    {
+        const std::size_t index = shardIndex(string);
+        Shard& shard = m_shards[index];
+
+        {
+            std::shared_lock lock{ shard.mutex };
+            if(const auto iterator = shard.ids.find(string); iterator != shard.ids.end())
+            {
+                return { iterator->second, iterator->first };
+            }
+        }
+
+        std::unique_lock lock{ shard.mutex };
+        if(const auto iterator = shard.ids.find(string); iterator != shard.ids.end())
+        {
+            return { iterator->second, iterator->first };
+        }
+
+        const SymbolId id = static_cast<SymbolId>((shard.symbols.size() << SHARD_BITS) | index);
+        const std::string_view symbol = shard.symbols.emplace_back(string);
+        shard.ids.emplace(symbol, id);
+
+        return { id, symbol };
+    }
+
+    std::optional<SymbolId> SymbolTable::find(std::string_view string) const
+    {
+        const Shard& shard = m_shards[shardIndex(string)];
+
+        std::shared_lock lock{ shard.mutex };
+        if(const auto iterator = shard.ids.find(string); iterator != shard.ids.end())
+        {
+            return iterator->second;
+        }
+
+        return std::nullopt;
+    }
+
+    std::string_view SymbolTable::symbol(SymbolId id) const
+    {
+        const Shard& shard = m_shards[id & (SHARD_COUNT - 1)];
+        const std::size_t index = id >> SHARD_BITS;
+
+        std::shared_lock lock{ shard.mutex };
+        if(index >= shard.symbols.size())
+        {
+            throw Exceptions::RuntimeException(fmt::format("Unknown symbol id {}", id));
+        }
+
+        return shard.symbols[index];
+    }
+
+    std::size_t SymbolTable::size() const
+    {
+        std::size_t size = 0;
+        for(const Shard& shard : m_shards)
+        {
+            std::shared_lock lock{ shard.mutex };
+            size += shard.symbols.size();
+        }
+
+        return size;
+    }
+
+    std::size_t SymbolTable::shardIndex(std::string_view string)
+    {
+        // Take the top bits of a Fibonacci hash, so that the shard is independent from the bucket within the shard
+        constexpr u8 FIBONACCI_MULTIPLIER = 0x9E3779B97F4A7C15;
+        const u8 hash = static_cast<u8>(std::hash<std::string_view>{}(string)) * FIBONACCI_MULTIPLIER;
+
+        return static_cast<std::size_t>(hash >> (64 - SHARD_BITS));
+    }
+} // namespace AeroJet::Java::ClassFile
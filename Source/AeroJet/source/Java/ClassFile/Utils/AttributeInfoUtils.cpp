@@ -31,4 +31,10 @@ namespace AeroJet::Java::ClassFile::Utils
         const u2 nameIndex = attributeInfo.attributeNameIndex();
         return constantPool.at(nameIndex).as<ConstantPoolInfoUtf8>().asString();
     }
+
+    std::string_view AttributeInfoUtils::extractNameView(const ConstantPool& constantPool, const AttributeInfo& attributeInfo)
+    {
+        const u2 nameIndex = attributeInfo.attributeNameIndex();
+        return constantPool.at(nameIndex).as<ConstantPoolInfoUtf8>().rawString();
+    }
 } // namespace AeroJet::Java::ClassFile::Utils
\ No newline at end of file
@@ -28,41 +28,58 @@
 
 namespace AeroJet::Java::ClassFile::Utils
 {
+    namespace
+    {
+        ConstantPoolInfoUtf8 nameEntry(const ClassInfo& classInfo)
+        {
+            const ConstantPool& constantPool = classInfo.constantPool();
+
+            const u2 thisClassIndex = classInfo.thisClass();
+            const u2 nameIndex = constantPool.at(thisClassIndex).as<ConstantPoolInfoClass>().nameIndex();
+            return constantPool.at(nameIndex).as<ConstantPoolInfoUtf8>();
+        }
+
+        /**
+         * @brief Last non-empty segment of name, trailing delimiters are ignored
+         */
+        std::string_view trimPackage(std::string_view name)
+        {
+            const std::size_t end = name.find_last_not_of(CLASS_PACKAGE_DELIMITER);
+            if(end == std::string_view::npos)
+            {
+                return {};
+            }
+
+            name = name.substr(0, end + 1);
+
+            const std::size_t delimiter = name.rfind(CLASS_PACKAGE_DELIMITER);
+            return delimiter == std::string_view::npos ? name : name.substr(delimiter + 1);
+        }
+    } // namespace
+
     bool ClassInfoUtils::isUnderPackage(const ClassInfo& classInfo)
     {
-        return ClassInfoUtils::name(classInfo).find(CLASS_PACKAGE_DELIMITER) != std::string::npos;
+        return ClassInfoUtils::nameView(classInfo).find(CLASS_PACKAGE_DELIMITER) != std::string_view::npos;
     }
 
     std::string ClassInfoUtils::name(const ClassInfo& classInfo)
     {
-        const ConstantPool& constantPool = classInfo.constantPool();
+        return nameEntry(classInfo).asString();
+    }
 
-        const u2 thisClassIndex = classInfo.thisClass();
-        const u2 nameIndex = constantPool.at(thisClassIndex).as<ConstantPoolInfoClass>().nameIndex();
-        return constantPool.at(nameIndex).as<ConstantPoolInfoUtf8>().asString();
+    std::string_view ClassInfoUtils::nameView(const ClassInfo& classInfo)
+    {
+        return nameEntry(classInfo).rawString();
     }
 
     std::string ClassInfoUtils::className(const ClassInfo& classInfo)
     {
-        std::string className = ClassInfoUtils::name(classInfo);
-
-        if(ClassInfoUtils::isUnderPackage(classInfo))
-        {
-            std::vector<std::string> split;
-            {
-                size_t start;
-                size_t end = 0;
-                while((start = className.find_first_not_of(CLASS_PACKAGE_DELIMITER, end)) != std::string::npos)
-                {
-                    end = className.find(CLASS_PACKAGE_DELIMITER, start);
-                    split.push_back(className.substr(start, end - start));
-                }
-            }
-
-            return split.back();
-        }
+        return std::string{ trimPackage(ClassInfoUtils::name(classInfo)) };
+    }
 
-        return className;
+    std::string_view ClassInfoUtils::classNameView(const ClassInfo& classInfo)
+    {
+        return trimPackage(ClassInfoUtils::nameView(classInfo));
     }
 
     std::string ClassInfoUtils::javaNameFromPath(const std::filesystem::path& path)
@@ -74,10 +91,23 @@ namespace AeroJet::Java::ClassFile::Utils
 
     std::string ClassInfoUtils::javaName(const ClassInfo& classInfo)
     {
-        std::string fullName = name(classInfo);
-        std::replace(fullName.begin(), fullName.end(), CLASS_PACKAGE_DELIMITER, JAVA_PACKAGE_DELIMITER);
+        std::string fullName;
+        static_cast<void>(javaName(classInfo, fullName));
 
         return fullName;
     }
 
+    std::string_view ClassInfoUtils::javaName(const ClassInfo& classInfo, std::string& storage)
+    {
+        const std::string_view fullName = nameEntry(classInfo).asStringView(storage);
+        if(fullName.data() != storage.data())
+        {
+            storage.assign(fullName);
+        }
+
+        std::replace(storage.begin(), storage.end(), CLASS_PACKAGE_DELIMITER, JAVA_PACKAGE_DELIMITER);
+
+        return storage;
+    }
+
 } // namespace AeroJet::Java::ClassFile::Utils
\ No newline at end of file
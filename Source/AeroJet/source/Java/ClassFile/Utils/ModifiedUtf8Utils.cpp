@@ -0,0 +1,359 @@
+/*
+ * ModifiedUtf8Utils.cpp
+ *
+ * Copyright © 2024 AeroJet Developers. All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the “Software”), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+ * OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "Java/ClassFile/Utils/ModifiedUtf8Utils.hpp"
+
+#include "Exceptions/RuntimeException.hpp"
+#include "fmt/format.h"
+
+#include <bit>
+#include <cstring>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    #define AEROJET_MODIFIED_UTF8_X86
+    #include <immintrin.h>
+#endif
+
+namespace AeroJet::Java::ClassFile::Utils
+{
+    namespace
+    {
+        constexpr u2 HIGH_SURROGATE_FIRST = 0xD800;
+        constexpr u2 LOW_SURROGATE_FIRST = 0xDC00;
+        constexpr u2 LOW_SURROGATE_LAST = 0xDFFF;
+        constexpr u2 REPLACEMENT_CHARACTER = 0xFFFD;
+
+        std::size_t asciiLengthScalar(const u1* data, std::size_t size, std::size_t offset)
+        {
+            constexpr u8 LOW_BITS = 0x0101010101010101;
+            constexpr u8 HIGH_BITS = 0x8080808080808080;
+
+            for(; offset + sizeof(u8) <= size; offset += sizeof(u8))
+            {
+                u8 word;
+                std::memcpy(&word, data + offset, sizeof(word));
+
+                // High bit set in any byte, or any byte equal to zero
+                if(((word | ((word - LOW_BITS) & ~word)) & HIGH_BITS) != 0)
+                {
+                    break;
+                }
+            }
+
+            while(offset < size && data[offset] != 0 && data[offset] < 0x80)
+            {
+                offset++;
+            }
+
+            return offset;
+        }
+
+#ifdef AEROJET_MODIFIED_UTF8_X86
+        __attribute__((target("sse2"))) std::size_t asciiLengthSse2(const u1* data, std::size_t size)
+        {
+            const __m128i zero = _mm_setzero_si128();
+
+            std::size_t offset = 0;
+            for(; offset + sizeof(__m128i) <= size; offset += sizeof(__m128i))
+            {
+                const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + offset));
+                const u4 mask = static_cast<u4>(_mm_movemask_epi8(_mm_or_si128(block, _mm_cmpeq_epi8(block, zero))));
+                if(mask != 0)
+                {
+                    return offset + std::countr_zero(mask);
+                }
+            }
+
+            return offset;
+        }
+
+        __attribute__((target("avx2"))) std::size_t asciiLengthAvx2(const u1* data, std::size_t size)
+        {
+            const __m256i zero = _mm256_setzero_si256();
+
+            std::size_t offset = 0;
+            for(; offset + sizeof(__m256i) <= size; offset += sizeof(__m256i))
+            {
+                const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + offset));
+                const u4 mask = static_cast<u4>(_mm256_movemask_epi8(_mm256_or_si256(block, _mm256_cmpeq_epi8(block, zero))));
+                if(mask != 0)
+                {
+                    return offset + std::countr_zero(mask);
+                }
+            }
+
+            return offset;
+        }
+
+        enum class InstructionSet : u1
+        {
+            SCALAR,
+            SSE2,
+            AVX2
+        };
+
+        InstructionSet detectInstructionSet()
+        {
+            __builtin_cpu_init();
+            if(__builtin_cpu_supports("avx2"))
+            {
+                return InstructionSet::AVX2;
+            }
+
+            if(__builtin_cpu_supports("sse2"))
+            {
+                return InstructionSet::SSE2;
+            }
+
+            return InstructionSet::SCALAR;
+        }
+#endif
+
+        /**
+         * Decodes a single UTF-16 code unit starting at offset. Rejects overlong forms except C0 80, four byte forms
+         * and stray continuation bytes.
+         * @return length of the encoded code unit, or 0 if it is malformed
+         */
+        std::size_t decodeCodeUnit(const u1* data, std::size_t size, std::size_t offset, u2& codeUnit)
+        {
+            const auto isContinuation = [&](std::size_t index)
+            {
+                return index < size && (data[index] & 0xC0) == 0x80;
+            };
+
+            const u1 first = data[offset];
+            if(first != 0 && first < 0x80)
+            {
+                codeUnit = first;
+                return 1;
+            }
+
+            if((first & 0xE0) == 0xC0 && isContinuation(offset + 1))
+            {
+                codeUnit = static_cast<u2>(((first & 0x1F) << 6) | (data[offset + 1] & 0x3F));
+                return (codeUnit == 0 || codeUnit >= 0x80) ? 2 : 0;
+            }
+
+            if((first & 0xF0) == 0xE0 && isContinuation(offset + 1) && isContinuation(offset + 2))
+            {
+                codeUnit = static_cast<u2>(((first & 0x0F) << 12) | ((data[offset + 1] & 0x3F) << 6) | (data[offset + 2] & 0x3F));
+                return codeUnit >= 0x800 ? 3 : 0;
+            }
+
+            return 0;
+        }
+
+        [[noreturn]] void throwMalformed(std::size_t offset)
+        {
+            throw Exceptions::RuntimeException(fmt::format("Malformed modified UTF-8 string at offset {}", offset));
+        }
+
+        void appendUtf8(std::string& string, u4 codePoint)
+        {
+            if(codePoint < 0x80)
+            {
+                string.push_back(static_cast<char>(codePoint));
+            }
+            else if(codePoint < 0x800)
+            {
+                string.push_back(static_cast<char>(0xC0 | (codePoint >> 6)));
+                string.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+            }
+            else if(codePoint < 0x10000)
+            {
+                string.push_back(static_cast<char>(0xE0 | (codePoint >> 12)));
+                string.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+                string.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+            }
+            else
+            {
+                string.push_back(static_cast<char>(0xF0 | (codePoint >> 18)));
+                string.push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F)));
+                string.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+                string.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+            }
+        }
+
+        bool isHighSurrogate(u2 codeUnit)
+        {
+            return codeUnit >= HIGH_SURROGATE_FIRST && codeUnit < LOW_SURROGATE_FIRST;
+        }
+
+        bool isLowSurrogate(u2 codeUnit)
+        {
+            return codeUnit >= LOW_SURROGATE_FIRST && codeUnit <= LOW_SURROGATE_LAST;
+        }
+    } // namespace
+
+    std::size_t ModifiedUtf8Utils::asciiLength(std::span<const u1> bytes)
+    {
+        std::size_t offset = 0;
+
+#ifdef AEROJET_MODIFIED_UTF8_X86
+        static const InstructionSet instructionSet = detectInstructionSet();
+        if(instructionSet == InstructionSet::AVX2)
+        {
+            offset = asciiLengthAvx2(bytes.data(), bytes.size());
+        }
+        else if(instructionSet == InstructionSet::SSE2)
+        {
+            offset = asciiLengthSse2(bytes.data(), bytes.size());
+        }
+#endif
+
+        return asciiLengthScalar(bytes.data(), bytes.size(), offset);
+    }
+
+    bool ModifiedUtf8Utils::isAscii(std::span<const u1> bytes)
+    {
+        return asciiLength(bytes) == bytes.size();
+    }
+
+    std::optional<std::size_t> ModifiedUtf8Utils::validate(std::span<const u1> bytes)
+    {
+        std::size_t offset = asciiLength(bytes);
+        while(offset < bytes.size())
+        {
+            u2 codeUnit;
+            const std::size_t length = decodeCodeUnit(bytes.data(), bytes.size(), offset, codeUnit);
+            if(length == 0)
+            {
+                return offset;
+            }
+
+            offset += length;
+            if(length != 1)
+            {
+                offset += asciiLength(bytes.subspan(offset));
+            }
+        }
+
+        return std::nullopt;
+    }
+
+    std::string_view ModifiedUtf8Utils::toUtf8(std::span<const u1> bytes, std::string& storage)
+    {
+        std::size_t offset = asciiLength(bytes);
+        if(offset == bytes.size())
+        {
+            return { reinterpret_cast<const char*>(bytes.data()), bytes.size() };
+        }
+
+        storage.clear();
+        storage.reserve(bytes.size());
+        storage.append(reinterpret_cast<const char*>(bytes.data()), offset);
+
+        while(offset < bytes.size())
+        {
+            u2 codeUnit;
+            const std::size_t length = decodeCodeUnit(bytes.data(), bytes.size(), offset, codeUnit);
+            if(length == 0)
+            {
+                throwMalformed(offset);
+            }
+
+            if(codeUnit == 0 || (codeUnit >= HIGH_SURROGATE_FIRST && codeUnit <= LOW_SURROGATE_LAST))
+            {
+                u4 codePoint = codeUnit;
+                if(isHighSurrogate(codeUnit))
+                {
+                    u2 nextCodeUnit = 0;
+                    const std::size_t nextOffset = offset + length;
+                    const std::size_t nextLength = nextOffset < bytes.size() ? decodeCodeUnit(bytes.data(), bytes.size(), nextOffset, nextCodeUnit) : 0;
+                    if(nextLength != 0 && isLowSurrogate(nextCodeUnit))
+                    {
+                        codePoint = 0x10000 + ((codeUnit - HIGH_SURROGATE_FIRST) << 10) + (nextCodeUnit - LOW_SURROGATE_FIRST);
+                        offset += nextLength;
+                    }
+                    else
+                    {
+                        codePoint = REPLACEMENT_CHARACTER;
+                    }
+                }
+                else if(isLowSurrogate(codeUnit))
+                {
+                    codePoint = REPLACEMENT_CHARACTER;
+                }
+
+                appendUtf8(storage, codePoint);
+            }
+            else
+            {
+                // Every other code unit is encoded identically in standard UTF-8
+                storage.append(reinterpret_cast<const char*>(bytes.data() + offset), length);
+            }
+
+            offset += length;
+
+            const std::size_t asciiCount = asciiLength(bytes.subspan(offset));
+            storage.append(reinterpret_cast<const char*>(bytes.data() + offset), asciiCount);
+            offset += asciiCount;
+        }
+
+        return storage;
+    }
+
+    std::string ModifiedUtf8Utils::toUtf8(std::span<const u1> bytes)
+    {
+        std::string storage;
+        const std::string_view string = toUtf8(bytes, storage);
+        if(string.data() != storage.data())
+        {
+            return std::string{ string };
+        }
+
+        return storage;
+    }
+
+    std::u16string ModifiedUtf8Utils::toUtf16(std::span<const u1> bytes)
+    {
+        std::u16string string;
+        string.reserve(bytes.size());
+
+        std::size_t offset = 0;
+        while(offset < bytes.size())
+        {
+            const std::size_t asciiCount = asciiLength(bytes.subspan(offset));
+            string.append(bytes.begin() + offset, bytes.begin() + offset + asciiCount);
+            offset += asciiCount;
+
+            if(offset == bytes.size())
+            {
+                break;
+            }
+
+            u2 codeUnit;
+            const std::size_t length = decodeCodeUnit(bytes.data(), bytes.size(), offset, codeUnit);
+            if(length == 0)
+            {
+                throwMalformed(offset);
+            }
+
+            string.push_back(static_cast<char16_t>(codeUnit));
+            offset += length;
+        }
+
+        return string;
+    }
+} // namespace AeroJet::Java::ClassFile::Utils
@@ -0,0 +1,160 @@
+/*
+ * ByteSwap.cpp
+ *
+ * Copyright © 2024 AeroJet Developers. All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the “Software”), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+ * OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "Stream/ByteSwap.hpp"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    #define AEROJET_BYTESWAP_X86
+    #include <immintrin.h>
+#endif
+
+namespace AeroJet::Stream
+{
+    namespace
+    {
+        template<typename T>
+        void swapEndianArrayScalar(const u1* source, u1* destination, std::size_t count)
+        {
+            for(std::size_t index = 0; index < count; index++)
+            {
+                T value;
+                std::memcpy(&value, source + index * sizeof(T), sizeof(T));
+                value = swapEndian(value);
+                std::memcpy(destination + index * sizeof(T), &value, sizeof(T));
+            }
+        }
+
+#ifdef AEROJET_BYTESWAP_X86
+        template<std::size_t elementSize>
+        __attribute__((target("ssse3"))) __m128i byteSwapMask128()
+        {
+            alignas(16) u1 mask[16];
+            for(std::size_t index = 0; index < sizeof(mask); index++)
+            {
+                mask[index] = static_cast<u1>((index / elementSize) * elementSize + (elementSize - 1 - index % elementSize));
+            }
+
+            return _mm_load_si128(reinterpret_cast<const __m128i*>(mask));
+        }
+
+        template<typename T>
+        __attribute__((target("ssse3"))) std::size_t swapEndianArraySsse3(const u1* source, u1* destination, std::size_t count)
+        {
+            const __m128i mask = byteSwapMask128<sizeof(T)>();
+            const std::size_t byteCount = count * sizeof(T);
+
+            std::size_t offset = 0;
+            for(; offset + sizeof(__m128i) <= byteCount; offset += sizeof(__m128i))
+            {
+                const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + offset));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + offset), _mm_shuffle_epi8(block, mask));
+            }
+
+            return offset / sizeof(T);
+        }
+
+        template<typename T>
+        __attribute__((target("avx2"))) std::size_t swapEndianArrayAvx2(const u1* source, u1* destination, std::size_t count)
+        {
+            const __m128i laneMask = byteSwapMask128<sizeof(T)>();
+            const __m256i mask = _mm256_broadcastsi128_si256(laneMask);
+            const std::size_t byteCount = count * sizeof(T);
+
+            std::size_t offset = 0;
+            for(; offset + sizeof(__m256i) <= byteCount; offset += sizeof(__m256i))
+            {
+                const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + offset));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(destination + offset), _mm256_shuffle_epi8(block, mask));
+            }
+
+            if(offset + sizeof(__m128i) <= byteCount)
+            {
+                const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + offset));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + offset), _mm_shuffle_epi8(block, laneMask));
+                offset += sizeof(__m128i);
+            }
+
+            return offset / sizeof(T);
+        }
+
+        enum class InstructionSet : u1
+        {
+            SCALAR,
+            SSSE3,
+            AVX2
+        };
+
+        InstructionSet detectInstructionSet()
+        {
+            __builtin_cpu_init();
+            if(__builtin_cpu_supports("avx2"))
+            {
+                return InstructionSet::AVX2;
+            }
+
+            if(__builtin_cpu_supports("ssse3"))
+            {
+                return InstructionSet::SSSE3;
+            }
+
+            return InstructionSet::SCALAR;
+        }
+#endif
+
+        template<typename T>
+        void swapEndianArray(const void* source, void* destination, std::size_t count)
+        {
+            const u1* sourceBytes = static_cast<const u1*>(source);
+            u1* destinationBytes = static_cast<u1*>(destination);
+
+            std::size_t swapped = 0;
+
+#ifdef AEROJET_BYTESWAP_X86
+            static const InstructionSet instructionSet = detectInstructionSet();
+            if(instructionSet == InstructionSet::AVX2)
+            {
+                swapped = swapEndianArrayAvx2<T>(sourceBytes, destinationBytes, count);
+            }
+            else if(instructionSet == InstructionSet::SSSE3)
+            {
+                swapped = swapEndianArraySsse3<T>(sourceBytes, destinationBytes, count);
+            }
+#endif
+
+            swapEndianArrayScalar<T>(sourceBytes + swapped * sizeof(T),
+                                     destinationBytes + swapped * sizeof(T),
+                                     count - swapped);
+        }
+    } // namespace
+
+    void swapEndianArray16(const void* source, void* destination, std::size_t count)
+    {
+        swapEndianArray<u2>(source, destination, count);
+    }
+
+    void swapEndianArray32(const void* source, void* destination, std::size_t count)
+    {
+        swapEndianArray<u4>(source, destination, count);
+    }
+} // namespace AeroJet::Stream
@@ -0,0 +1,210 @@
+/*
+ * MappedFile.cpp
+ *
+ * Copyright © 2024 AeroJet Developers. All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the “Software”), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+ * OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "Stream/MappedFile.hpp"
+
+#include "Exceptions/FileNotFoundException.hpp"
+#include "Exceptions/RuntimeException.hpp"
+#include "fmt/format.h"
+
+#include <utility>
+
+#ifdef _WIN32
+    #define WIN32_LEAN_AND_MEAN
+    #include <windows.h>
+#else
+    #include <cerrno>
+    #include <cstring>
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace AeroJet::Stream
+{
+    MappedFile::MappedFile(const std::filesystem::path& path) :
+        m_path(path), m_data(nullptr), m_size(0)
+#ifdef _WIN32
+        ,
+        m_fileHandle(INVALID_HANDLE_VALUE), m_mappingHandle(nullptr)
+#endif
+    {
+        if(!std::filesystem::exists(path))
+        {
+            throw Exceptions::FileNotFoundException(path);
+        }
+
+#ifdef _WIN32
+        m_fileHandle = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if(m_fileHandle == INVALID_HANDLE_VALUE)
+        {
+            throw Exceptions::RuntimeException(fmt::format("Failed to open \"{}\"! Error: {}", path.string(), GetLastError()));
+        }
+
+        LARGE_INTEGER fileSize{};
+        if(!GetFileSizeEx(m_fileHandle, &fileSize))
+        {
+            const DWORD error = GetLastError();
+            unmap();
+            throw Exceptions::RuntimeException(fmt::format("Failed to get size of \"{}\"! Error: {}", path.string(), error));
+        }
+
+        m_size = static_cast<std::size_t>(fileSize.QuadPart);
+        if(m_size == 0)
+        {
+            return;
+        }
+
+        m_mappingHandle = CreateFileMappingW(m_fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if(m_mappingHandle == nullptr)
+        {
+            const DWORD error = GetLastError();
+            unmap();
+            throw Exceptions::RuntimeException(fmt::format("Failed to map \"{}\"! Error: {}", path.string(), error));
+        }
+
+        m_data = static_cast<const u1*>(MapViewOfFile(m_mappingHandle, FILE_MAP_READ, 0, 0, 0));
+        if(m_data == nullptr)
+        {
+            const DWORD error = GetLastError();
+            unmap();
+            throw Exceptions::RuntimeException(fmt::format("Failed to map \"{}\"! Error: {}", path.string(), error));
+        }
+#else
+        const int fileDescriptor = open(path.c_str(), O_RDONLY);
+        if(fileDescriptor < 0)
+        {
+            throw Exceptions::RuntimeException(fmt::format("Failed to open \"{}\"! Error: {}", path.string(), std::strerror(errno)));
+        }
+
+        struct stat fileStat
+        {
+        };
+        if(fstat(fileDescriptor, &fileStat) != 0)
+        {
+            const int error = errno;
+            close(fileDescriptor);
+            throw Exceptions::RuntimeException(fmt::format("Failed to get size of \"{}\"! Error: {}", path.string(), std::strerror(error)));
+        }
+
+        m_size = static_cast<std::size_t>(fileStat.st_size);
+        if(m_size == 0)
+        {
+            close(fileDescriptor);
+            return;
+        }
+
+        void* data = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+        const int error = errno;
+        close(fileDescriptor);
+
+        if(data == MAP_FAILED)
+        {
+            m_size = 0;
+            throw Exceptions::RuntimeException(fmt::format("Failed to map \"{}\"! Error: {}", path.string(), std::strerror(error)));
+        }
+
+        m_data = static_cast<const u1*>(data);
+#endif
+    }
+
+    MappedFile::MappedFile(MappedFile&& other) noexcept :
+        m_path(std::move(other.m_path)), m_data(std::exchange(other.m_data, nullptr)), m_size(std::exchange(other.m_size, 0))
+#ifdef _WIN32
+        ,
+        m_fileHandle(std::exchange(other.m_fileHandle, INVALID_HANDLE_VALUE)),
+        m_mappingHandle(std::exchange(other.m_mappingHandle, nullptr))
+#endif
+    {
+    }
+
+    MappedFile::~MappedFile()
+    {
+        unmap();
+    }
+
+    MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+    {
+        if(this != &other)
+        {
+            unmap();
+
+            m_path = std::move(other.m_path);
+            m_data = std::exchange(other.m_data, nullptr);
+            m_size = std::exchange(other.m_size, 0);
+#ifdef _WIN32
+            m_fileHandle = std::exchange(other.m_fileHandle, INVALID_HANDLE_VALUE);
+            m_mappingHandle = std::exchange(other.m_mappingHandle, nullptr);
+#endif
+        }
+
+        return *this;
+    }
+
+    const std::filesystem::path& MappedFile::path() const
+    {
+        return m_path;
+    }
+
+    std::span<const u1> MappedFile::bytes() const
+    {
+        return { m_data, m_size };
+    }
+
+    std::size_t MappedFile::size() const
+    {
+        return m_size;
+    }
+
+    void MappedFile::unmap()
+    {
+#ifdef _WIN32
+        if(m_data != nullptr)
+        {
+            UnmapViewOfFile(m_data);
+        }
+
+        if(m_mappingHandle != nullptr)
+        {
+            CloseHandle(m_mappingHandle);
+        }
+
+        if(m_fileHandle != INVALID_HANDLE_VALUE)
+        {
+            CloseHandle(m_fileHandle);
+        }
+
+        m_mappingHandle = nullptr;
+        m_fileHandle = INVALID_HANDLE_VALUE;
+#else
+        if(m_data != nullptr)
+        {
+            munmap(const_cast<u1*>(m_data), m_size);
+        }
+#endif
+        m_data = nullptr;
+        m_size = 0;
+    }
+} // namespace AeroJet::Stream
@@ -0,0 +1,55 @@
+/*
+ * ReadError.cpp
+ *
+ * Copyright © 2024 AeroJet Developers. All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the “Software”), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+ * OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "Stream/ReadError.hpp"
+
+namespace AeroJet::Stream
+{
+    std::string_view ReadError::description() const
+    {
+        switch(code)
+        {
+            case ReadErrorCode::UNEXPECTED_END:
+                return "Unexpected end of data";
+            case ReadErrorCode::NOT_A_CLASS_FILE:
+                return "Not a Java class";
+            case ReadErrorCode::UNSUPPORTED_CLASS_VERSION:
+                return "Unsupported Java class version";
+            case ReadErrorCode::UNKNOWN_CONSTANT_POOL_TAG:
+                return "Unexpected Constant Pool Entry Tag";
+            case ReadErrorCode::UNKNOWN_OPCODE:
+                return "Unsupported OpCode";
+            case ReadErrorCode::UNEXPECTED_WIDE_OPCODE:
+                return "Unexpected OpCode after 'wide'";
+            case ReadErrorCode::INVALID_SWITCH:
+                return "Invalid tableswitch/lookupswitch operands";
+            case ReadErrorCode::MALFORMED_MODIFIED_UTF8:
+                return "Malformed modified UTF-8 string";
+            case ReadErrorCode::INVALID_CONSTANT_POOL_INDEX:
+                return "Invalid Constant Pool index";
+        }
+
+        return "Unknown error";
+    }
+} // namespace AeroJet::Stream
@@ -24,67 +24,19 @@
 
 #include "Stream/Reader.hpp"
 
-#include "Exceptions/RuntimeException.hpp"
-#include "fmt/format.h"
+#include <algorithm>
 
 namespace AeroJet::Stream::Reader
 {
-    template<typename T>
-    static T swapEndian(const T& data)
-    {
-        static_assert(CHAR_BIT == 8, "CHAR_BIT != 8");
-
-        union ByteObjectRepresentation
-        {
-            T object;
-            unsigned char bytes[sizeof(T)];
-        };
-
-        ByteObjectRepresentation source{};
-        ByteObjectRepresentation dst{};
-
-        source.object = data;
-
-        for(size_t k = 0; k < sizeof(T); k++)
-        {
-            dst.bytes[k] = source.bytes[sizeof(T) - k - 1];
-        }
-
-        return dst.object;
-    }
-
     template<typename T>
     static inline T readInternal(std::istream& stream, ByteOrder byteOrder)
     {
-        const std::size_t readSize = sizeof(T);
-
-        if(stream.eof())
+        if(byteOrder == ByteOrder::INVERSE)
         {
-            throw Exceptions::RuntimeException(
-                fmt::format("stream EOF at {:#08x}! Read size was {}", static_cast<std::size_t>(stream.tellg()), readSize));
+            return read<T, ByteOrder::INVERSE>(stream);
         }
 
-        const std::istream::pos_type currentPos = stream.tellg();
-
-        stream.seekg(0, std::ios::end);
-        const std::istream::pos_type endPos = stream.tellg();
-        stream.seekg(currentPos);
-
-        if((static_cast<std::size_t>(currentPos) + readSize) > static_cast<std::size_t>(endPos))
-        {
-            throw Exceptions::RuntimeException(
-                fmt::format("Attempt to read {} bytes while {} is available", readSize, endPos - currentPos));
-        }
-
-        T read{};
-        stream.read((char*)&read, readSize);
-
-        if(byteOrder == ByteOrder::INVERSE && readSize > 1)
-        {
-            read = swapEndian(read);
-        }
-
-        return read;
+        return read<T, ByteOrder::DEFAULT>(stream);
     }
 
     template<>
@@ -134,4 +86,30 @@ namespace AeroJet::Stream::Reader
     {
         return readInternal<u8>(stream, byteOrder);
     }
+
+    bool readChunk(std::istream& stream, std::vector<u1>& bytes, std::size_t count)
+    {
+        static constexpr std::size_t BLOCK_SIZE = 4096;
+
+        // Unbounded chunks are read block by block instead of reserving count bytes up front
+        std::size_t remaining = count;
+        while(remaining != 0)
+        {
+            const std::size_t blockSize = std::min(remaining, BLOCK_SIZE);
+            const std::size_t size = bytes.size();
+            bytes.resize(size + blockSize);
+            stream.read(reinterpret_cast<char*>(bytes.data() + size), static_cast<std::streamsize>(blockSize));
+
+            const std::size_t readCount = static_cast<std::size_t>(stream.gcount());
+            bytes.resize(size + readCount);
+            if(readCount != blockSize)
+            {
+                return false;
+            }
+
+            remaining -= blockSize;
+        }
+
+        return true;
+    }
 } // namespace AeroJet::Stream::Reader
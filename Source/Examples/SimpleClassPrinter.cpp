@@ -25,9 +25,7 @@
 #include "AeroJet.hpp"
 #include "fmt/format.h"
 
-#include <algorithm>
 #include <filesystem>
-#include <fstream>
 
 int main(int argc, char** argv)
 {
@@ -38,14 +36,13 @@ int main(int argc, char** argv)
     }
 
     std::filesystem::path classFilePath = argv[1];
-    std::ifstream fileStream(classFilePath);
-    if(!fileStream.is_open())
+    if(!std::filesystem::exists(classFilePath))
     {
         fmt::print("Failed to open file '{}'", classFilePath.string());
         return 1;
     }
 
-    auto classInfo = AeroJet::Stream::Reader::read<AeroJet::Java::ClassFile::ClassInfo>(fileStream, AeroJet::Stream::ByteOrder::INVERSE);
+    auto classInfo = AeroJet::Java::ClassFile::ClassInfo::load(classFilePath);
     const auto& constantPool = classInfo.constantPool();
 
     fmt::print("ClassFile {}\n", classFilePath.string());
@@ -55,15 +52,11 @@ int main(int argc, char** argv)
     {
         const std::string methodName = constantPool.at(methodInfo.nameIndex()).as<AeroJet::Java::ClassFile::ConstantPoolInfoUtf8>().asString();
         fmt::print("\t\t{}\n", methodName);
-        const std::vector<AeroJet::Java::ClassFile::AttributeInfo>& methodAttributes = methodInfo.attributes();
-        auto codeAttributeIt = std::find_if(methodAttributes.begin(), methodAttributes.end(), [&constantPool](const AeroJet::Java::ClassFile::AttributeInfo& attributeInfo)
-                                            { return AeroJet::Java::ClassFile::Utils::AttributeInfoUtils::extractName(constantPool, attributeInfo) == AeroJet::Java::ClassFile::Code::CODE_ATTRIBUTE_NAME; });
-
-        if(codeAttributeIt != methodAttributes.end())
+        const AeroJet::Java::ClassFile::Code* codeAttribute = methodInfo.code(constantPool);
+        if(codeAttribute != nullptr)
         {
             fmt::print("\t\t\tCode:\n");
-            AeroJet::Java::ClassFile::Code codeAttribute{ constantPool, *codeAttributeIt };
-            for(const auto& instruction : codeAttribute.code())
+            for(const auto& instruction : codeAttribute->code())
             {
                 fmt::print("\t\t\t\t{:#04x}\n", static_cast<AeroJet::u1>(instruction.opCode()));
             }
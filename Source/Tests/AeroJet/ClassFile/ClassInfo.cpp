@@ -27,6 +27,40 @@
 #include "AeroJet.hpp"
 #include "doctest.h"
 
+#include <atomic>
+#include <cstdlib>
+#include <memory_resource>
+#include <new>
+#include <sstream>
+#include <thread>
+
+namespace
+{
+    // Counts allocations which bypass memory resources, e.g. make_shared
+    std::atomic<std::size_t> globalAllocations{ 0 };
+} // namespace
+
+void* operator new(std::size_t size)
+{
+    globalAllocations.fetch_add(1, std::memory_order_relaxed);
+    if(void* pointer = std::malloc(size == 0 ? 1 : size))
+    {
+        return pointer;
+    }
+
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t /*size*/) noexcept
+{
+    std::free(pointer);
+}
+
 TEST_CASE("AeroJet::Java::ClassFile::Instructions::table_switch")
 {
     std::ifstream inputFileStream{ "Resources/TestJavaBytecodeTableSwitch.class" };
@@ -810,4 +844,1235 @@ TEST_CASE("AeroJet::Java::ClassFile::Instructions::table_switch")
             }
         }
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("AeroJet::Java::ClassFile::ClassInfo::load")
+{
+    const AeroJet::Java::ClassFile::ClassInfo classInfo =
+        AeroJet::Java::ClassFile::ClassInfo::load("Resources/TestJavaBytecodeTableSwitch.class");
+
+    CHECK_EQ(classInfo.bytes().size(), std::filesystem::file_size("Resources/TestJavaBytecodeTableSwitch.class"));
+    CHECK_EQ(classInfo.constantPool().size(), 54);
+    CHECK_EQ(classInfo.methods().size(), 2);
+    CHECK_EQ(AeroJet::Java::ClassFile::Utils::ClassInfoUtils::name(classInfo), "TestJavaBytecodeTableSwitch");
+
+    SUBCASE("Attribute payloads are borrowed from class bytes")
+    {
+        const std::span<const AeroJet::u1> bytes = classInfo.bytes();
+        for(const auto& method : classInfo.methods())
+        {
+            for(const auto& attribute : method.attributes())
+            {
+                const std::span<const AeroJet::u1> info = attribute.info();
+                CHECK(info.data() >= bytes.data());
+                CHECK(info.data() + info.size() <= bytes.data() + bytes.size());
+                CHECK(std::equal(info.begin(), info.end(), attribute.copyInfo().begin()));
+            }
+        }
+    }
+
+    SUBCASE("Code attribute parses in place")
+    {
+        const std::span<const AeroJet::u1> bytes = classInfo.bytes();
+        const AeroJet::Java::ClassFile::Code codeAttribute{ classInfo.constantPool(),
+                                                            classInfo.methods()[0].attributes()[0] };
+
+        CHECK_EQ(codeAttribute.code().size(), 3);
+        REQUIRE_FALSE(codeAttribute.attributes().empty());
+        for(const auto& attribute : codeAttribute.attributes())
+        {
+            CHECK(attribute.info().data() >= bytes.data());
+            CHECK(attribute.info().data() + attribute.info().size() <= bytes.data() + bytes.size());
+        }
+    }
+
+    SUBCASE("Missing file")
+    {
+        CHECK_THROWS_AS(static_cast<void>(AeroJet::Java::ClassFile::ClassInfo::load("Resources/Missing.class")),
+                        AeroJet::Exceptions::FileNotFoundException);
+    }
+}
+
+TEST_CASE("AeroJet::Stream::Reader::readBuffered")
+{
+    constexpr AeroJet::u2 ATTRIBUTES_COUNT = 200;
+
+    AeroJet::Stream::ByteBuffer buffer;
+    for(AeroJet::u2 attributeIndex = 0; attributeIndex < ATTRIBUTES_COUNT; attributeIndex++)
+    {
+        buffer.write<AeroJet::u2>(attributeIndex);
+        buffer.write<AeroJet::u4>(3);
+        buffer.write<AeroJet::u1>(1);
+        buffer.write<AeroJet::u2>(attributeIndex);
+    }
+    buffer.write<AeroJet::u1>(static_cast<AeroJet::u1>(AeroJet::Java::ClassFile::ConstantPoolInfoTag::INTEGER));
+    buffer.write<AeroJet::u4>(42);
+    buffer.write<AeroJet::u1>(static_cast<AeroJet::u1>(AeroJet::Java::ClassFile::ConstantPoolInfoTag::INTEGER));
+
+    std::stringstream stream{ std::string{ buffer.bytes().begin(), buffer.bytes().end() } };
+    for(AeroJet::u2 attributeIndex = 0; attributeIndex < ATTRIBUTES_COUNT; attributeIndex++)
+    {
+        const AeroJet::Java::ClassFile::AttributeInfo attribute =
+            AeroJet::Stream::Reader::read<AeroJet::Java::ClassFile::AttributeInfo>(stream, AeroJet::Stream::ByteOrder::INVERSE);
+        CHECK_EQ(attribute.attributeNameIndex(), attributeIndex);
+        CHECK_EQ(attribute.size(), 3);
+
+        // The stream is left right after the attribute
+        const std::streamoff position = stream.tellg();
+        CHECK_EQ(position, (attributeIndex + 1) * 9);
+    }
+
+    const AeroJet::Java::ClassFile::ConstantPoolEntry entry =
+        AeroJet::Stream::Reader::read<AeroJet::Java::ClassFile::ConstantPoolEntry>(stream, AeroJet::Stream::ByteOrder::INVERSE);
+    CHECK_EQ(entry.as<AeroJet::Java::ClassFile::ConstantPoolInfoInteger>().bytes(), 42);
+
+    // Truncated entry
+    CHECK_THROWS_AS(static_cast<void>(AeroJet::Stream::Reader::read<AeroJet::Java::ClassFile::ConstantPoolEntry>(
+                        stream, AeroJet::Stream::ByteOrder::INVERSE)),
+                    AeroJet::Exceptions::RuntimeException);
+}
+
+TEST_CASE("AeroJet::Java::ClassFile::ClassInfo::tryLoad")
+{
+    std::ifstream inputFileStream{ "Resources/TestJavaBytecodeTableSwitch.class", std::ios::binary };
+    REQUIRE(inputFileStream.is_open());
+
+    const std::vector<AeroJet::u1> bytes{ std::istreambuf_iterator<char>(inputFileStream), std::istreambuf_iterator<char>() };
+
+    SUBCASE("Valid class")
+    {
+        const AeroJet::Stream::ReadResult<AeroJet::Java::ClassFile::ClassInfo> classInfo =
+            AeroJet::Java::ClassFile::ClassInfo::tryLoad(bytes);
+
+        REQUIRE(classInfo.hasValue());
+        CHECK_EQ(classInfo->constantPool().size(), 54);
+    }
+
+    SUBCASE("Bad magic")
+    {
+        std::vector<AeroJet::u1> corrupted = bytes;
+        corrupted[0] = 0x00;
+
+        const auto classInfo = AeroJet::Java::ClassFile::ClassInfo::tryLoad(corrupted);
+        REQUIRE_FALSE(classInfo.hasValue());
+        CHECK(classInfo.error().code == AeroJet::Stream::ReadErrorCode::NOT_A_CLASS_FILE);
+        CHECK_EQ(classInfo.error().offset, 0);
+        CHECK_THROWS_AS(static_cast<void>(AeroJet::Java::ClassFile::ClassInfo::load(corrupted)),
+                        AeroJet::Exceptions::RuntimeException);
+    }
+
+    SUBCASE("Unsupported version")
+    {
+        std::vector<AeroJet::u1> corrupted = bytes;
+        corrupted[7] = 0x40;
+
+        const auto classInfo = AeroJet::Java::ClassFile::ClassInfo::tryLoad(corrupted);
+        REQUIRE_FALSE(classInfo.hasValue());
+        CHECK(classInfo.error().code == AeroJet::Stream::ReadErrorCode::UNSUPPORTED_CLASS_VERSION);
+        CHECK_EQ(classInfo.error().offset, 6);
+    }
+
+    SUBCASE("Unknown constant pool tag")
+    {
+        std::vector<AeroJet::u1> corrupted = bytes;
+        corrupted[10] = 0x02;
+
+        const auto classInfo = AeroJet::Java::ClassFile::ClassInfo::tryLoad(corrupted);
+        REQUIRE_FALSE(classInfo.hasValue());
+        CHECK(classInfo.error().code == AeroJet::Stream::ReadErrorCode::UNKNOWN_CONSTANT_POOL_TAG);
+        CHECK_EQ(classInfo.error().offset, 10);
+    }
+
+    SUBCASE("Truncated")
+    {
+        for(const std::size_t size : { std::size_t{ 0 }, std::size_t{ 9 }, bytes.size() / 2, bytes.size() - 1 })
+        {
+            const auto classInfo = AeroJet::Java::ClassFile::ClassInfo::tryLoad({ bytes.begin(), bytes.begin() + size });
+            REQUIRE_FALSE(classInfo.hasValue());
+            CHECK(classInfo.error().code == AeroJet::Stream::ReadErrorCode::UNEXPECTED_END);
+            CHECK(classInfo.error().offset <= size);
+        }
+    }
+
+    SUBCASE("Unknown opcode")
+    {
+        const std::vector<AeroJet::u1> code{ 0xCB };
+
+        AeroJet::Stream::ByteCursor cursor{ code };
+        const auto instruction = AeroJet::Stream::Reader::tryRead<AeroJet::Java::ByteCode::Instruction>(cursor);
+        REQUIRE_FALSE(instruction.hasValue());
+        CHECK(instruction.error().code == AeroJet::Stream::ReadErrorCode::UNKNOWN_OPCODE);
+
+        AeroJet::Stream::ByteCursor throwingCursor{ code };
+        CHECK_THROWS_AS(static_cast<void>(AeroJet::Stream::Reader::read<AeroJet::Java::ByteCode::Instruction>(throwingCursor)),
+                        AeroJet::Exceptions::OperationNotSupportedException);
+    }
+}
+
+TEST_CASE("AeroJet::Java::ClassFile::ClassInfoParser")
+{
+    std::ifstream inputFileStream{ "Resources/TestJavaBytecodeTableSwitch.class", std::ios::binary };
+    REQUIRE(inputFileStream.is_open());
+
+    const std::vector<AeroJet::u1> bytes{ std::istreambuf_iterator<char>(inputFileStream), std::istreambuf_iterator<char>() };
+    const std::span<const AeroJet::u1> byteSpan{ bytes };
+
+    SUBCASE("Chunked input")
+    {
+        for(const std::size_t chunkSize : { 1, 7, 64, 4096 })
+        {
+            AeroJet::Java::ClassFile::ClassInfoParser parser;
+            for(std::size_t offset = 0; offset < byteSpan.size(); offset += chunkSize)
+            {
+                parser.feed(byteSpan.subspan(offset, std::min(chunkSize, byteSpan.size() - offset)));
+            }
+
+            REQUIRE(parser.finish() == AeroJet::Java::ClassFile::ClassInfoParser::State::COMPLETE);
+            CHECK_EQ(parser.consumed(), bytes.size());
+
+            const AeroJet::Java::ClassFile::ClassInfo classInfo = parser.result();
+            CHECK_EQ(classInfo.constantPool().size(), 54);
+            CHECK_EQ(AeroJet::Java::ClassFile::Utils::ClassInfoUtils::name(classInfo), "TestJavaBytecodeTableSwitch");
+            CHECK_EQ(classInfo.methods().size(), 2);
+
+            const AeroJet::Java::ClassFile::Code codeAttribute{ classInfo.constantPool(), classInfo.methods()[1].attributes()[0] };
+            CHECK_EQ(codeAttribute.code().size(), 22);
+
+            CHECK_THROWS_AS(static_cast<void>(parser.result()), AeroJet::Exceptions::RuntimeException);
+        }
+    }
+
+    SUBCASE("Truncated input")
+    {
+        AeroJet::Java::ClassFile::ClassInfoParser parser;
+        CHECK(parser.feed(byteSpan.first(byteSpan.size() - 1)) == AeroJet::Java::ClassFile::ClassInfoParser::State::NEED_MORE_DATA);
+        CHECK(parser.finish() == AeroJet::Java::ClassFile::ClassInfoParser::State::FAILED);
+        CHECK(parser.error().code == AeroJet::Stream::ReadErrorCode::UNEXPECTED_END);
+        CHECK_THROWS_AS(static_cast<void>(parser.result()), AeroJet::Exceptions::RuntimeException);
+    }
+
+    SUBCASE("Malformed input")
+    {
+        std::vector<AeroJet::u1> corrupted = bytes;
+        corrupted[10] = 0xFF;
+
+        AeroJet::Java::ClassFile::ClassInfoParser parser;
+        parser.feed(std::span<const AeroJet::u1>{ corrupted }.first(8));
+        CHECK(parser.feed(std::span<const AeroJet::u1>{ corrupted }.subspan(8)) == AeroJet::Java::ClassFile::ClassInfoParser::State::FAILED);
+        CHECK(parser.error().code == AeroJet::Stream::ReadErrorCode::UNKNOWN_CONSTANT_POOL_TAG);
+        CHECK_EQ(parser.error().offset, 10);
+    }
+
+    SUBCASE("Stream")
+    {
+        std::istringstream stream{ std::string{ bytes.begin(), bytes.end() } };
+        const AeroJet::Java::ClassFile::ClassInfo classInfo = AeroJet::Java::ClassFile::ClassInfoParser::parse(stream, 13);
+        CHECK_EQ(classInfo.constantPool().size(), 54);
+        CHECK_EQ(classInfo.fields().size(), 0);
+    }
+
+    SUBCASE("Attribute kinds")
+    {
+        std::istringstream stream{ std::string{ bytes.begin(), bytes.end() } };
+        const AeroJet::Java::ClassFile::ClassInfo classInfo = AeroJet::Java::ClassFile::ClassInfoParser::parse(stream, 13);
+
+        const AeroJet::Java::ClassFile::AttributeInfo* sourceFile =
+            classInfo.findAttribute(AeroJet::Java::ClassFile::AttributeKind::SOURCE_FILE);
+        REQUIRE_NE(sourceFile, nullptr);
+        CHECK(sourceFile->kind() == AeroJet::Java::ClassFile::AttributeKind::SOURCE_FILE);
+
+        const AeroJet::Java::ClassFile::MethodInfo& method = classInfo.methods()[1];
+        CHECK_NE(method.findAttribute(AeroJet::Java::ClassFile::AttributeKind::CODE), nullptr);
+
+        const AeroJet::Java::ClassFile::Code* code = method.code(classInfo.constantPool());
+        REQUIRE_NE(code, nullptr);
+        CHECK_EQ(code->code().size(), 22);
+        CHECK_NE(code->findAttribute(AeroJet::Java::ClassFile::AttributeKind::LINE_NUMBER_TABLE), nullptr);
+    }
+
+    SUBCASE("Attribute filter")
+    {
+        const AeroJet::Java::ClassFile::AttributeFilter codeOnly{ "Code" };
+        for(const std::size_t chunkSize : { 1, 5, 4096 })
+        {
+            std::istringstream stream{ std::string{ bytes.begin(), bytes.end() } };
+            const AeroJet::Java::ClassFile::ClassInfo classInfo =
+                AeroJet::Java::ClassFile::ClassInfoParser::parse(stream, chunkSize, codeOnly);
+
+            CHECK(classInfo.attributes().empty());
+            REQUIRE_EQ(classInfo.methods().size(), 2);
+            for(const AeroJet::Java::ClassFile::MethodInfo& method : classInfo.methods())
+            {
+                REQUIRE_EQ(method.attributes().size(), 1);
+                CHECK(method.attributes()[0].kind() == AeroJet::Java::ClassFile::AttributeKind::CODE);
+            }
+
+            const AeroJet::Java::ClassFile::Code* code = classInfo.methods()[1].code(classInfo.constantPool());
+            REQUIRE_NE(code, nullptr);
+            CHECK_EQ(code->code().size(), 22);
+        }
+
+        AeroJet::Java::ClassFile::ClassInfoParser parser{ AeroJet::Java::ClassFile::AttributeFilter::none() };
+        for(std::size_t offset = 0; offset < byteSpan.size(); offset += 3)
+        {
+            parser.feed(byteSpan.subspan(offset, std::min<std::size_t>(3, byteSpan.size() - offset)));
+        }
+
+        REQUIRE(parser.finish() == AeroJet::Java::ClassFile::ClassInfoParser::State::COMPLETE);
+        CHECK_EQ(parser.consumed(), bytes.size());
+
+        const AeroJet::Java::ClassFile::ClassInfo classInfo = parser.result();
+        CHECK(classInfo.attributes().empty());
+        CHECK(classInfo.methods()[1].attributes().empty());
+        CHECK_EQ(classInfo.methods()[1].code(classInfo.constantPool()), nullptr);
+    }
+
+    SUBCASE("Failing stream")
+    {
+        class FailingStreamBuffer final : public std::streambuf
+        {
+          protected:
+            int_type underflow() override
+            {
+                throw std::runtime_error("Device failure");
+            }
+        };
+
+        FailingStreamBuffer streamBuffer;
+        std::istream stream{ &streamBuffer };
+
+        // Reported as a read failure rather than as a truncated class
+        std::string message;
+        try
+        {
+            static_cast<void>(AeroJet::Java::ClassFile::ClassInfoParser::parse(stream));
+        }
+        catch(const AeroJet::Exceptions::RuntimeException& exception)
+        {
+            message = exception.what();
+        }
+
+        CHECK(message.starts_with("Failed to read"));
+    }
+}
+
+TEST_CASE("AeroJet::Java::ClassFile::ConstantPool")
+{
+    AeroJet::Java::ClassFile::ConstantPool constantPool;
+    constantPool.reserve(5);
+    constantPool.insert({ 1, AeroJet::Java::ClassFile::ConstantPoolEntry::wideValue(AeroJet::Java::ClassFile::ConstantPoolInfoTag::LONG, 0, 42) });
+    constantPool.insert({ 3, AeroJet::Java::ClassFile::ConstantPoolEntry::indices(AeroJet::Java::ClassFile::ConstantPoolInfoTag::CLASS, 4) });
+    constantPool.insert({ 4, AeroJet::Java::ClassFile::ConstantPoolEntry::indices(AeroJet::Java::ClassFile::ConstantPoolInfoTag::STRING, 3) });
+
+    CHECK_EQ(constantPool.size(), 3);
+    CHECK(constantPool.at(3).tag() == AeroJet::Java::ClassFile::ConstantPoolInfoTag::CLASS);
+    CHECK_EQ(constantPool.at(3).as<AeroJet::Java::ClassFile::ConstantPoolInfoClass>().nameIndex(), 4);
+    CHECK_EQ(constantPool.at(1).as<AeroJet::Java::ClassFile::ConstantPoolInfoLong>().lowBytes(), 42);
+
+    CHECK_FALSE(constantPool.contains(0));
+    CHECK_FALSE(constantPool.contains(2));
+    CHECK_FALSE(constantPool.contains(5));
+    CHECK_THROWS_AS(static_cast<void>(constantPool.at(0)), std::out_of_range);
+    CHECK_THROWS_AS(static_cast<void>(constantPool.at(2)), std::out_of_range);
+    CHECK_THROWS_AS(static_cast<void>(constantPool.at(5)), std::out_of_range);
+
+    std::vector<AeroJet::u2> indices;
+    for(const auto& [index, entry] : constantPool)
+    {
+        indices.push_back(index);
+    }
+
+    const std::vector<AeroJet::u2> expectedIndices{ 1, 3, 4 };
+    CHECK(indices == expectedIndices);
+}
+
+TEST_CASE("AeroJet::Java::ClassFile::ConstantPool::Decoding::LAZY")
+{
+    const AeroJet::Java::ClassFile::ClassInfo eager = AeroJet::Java::ClassFile::ClassInfo::load("Resources/TestJavaBytecodeTableSwitch.class");
+    const AeroJet::Java::ClassFile::ClassInfo lazy = AeroJet::Java::ClassFile::ClassInfo::load("Resources/TestJavaBytecodeTableSwitch.class",
+                                                                                                AeroJet::Java::ClassFile::ConstantPool::Decoding::LAZY);
+
+    const AeroJet::Java::ClassFile::ConstantPool& constantPool = lazy.constantPool();
+    CHECK(constantPool.isLazy());
+    CHECK_FALSE(eager.constantPool().isLazy());
+    CHECK_EQ(constantPool.size(), 54);
+    CHECK_EQ(AeroJet::Java::ClassFile::Utils::ClassInfoUtils::name(lazy), "TestJavaBytecodeTableSwitch");
+
+    std::size_t entriesCount = 0;
+    for(const auto& [index, entry] : constantPool)
+    {
+        const AeroJet::Java::ClassFile::ConstantPoolEntry& eagerEntry = eager.constantPool().at(index);
+        CHECK(entry.tag() == eagerEntry.tag());
+        if(entry.tag() == AeroJet::Java::ClassFile::ConstantPoolInfoTag::UTF_8)
+        {
+            CHECK_EQ(constantPool.symbol(index), eager.constantPool().symbol(index));
+        }
+        entriesCount++;
+    }
+    CHECK_EQ(entriesCount, 54);
+
+    // Entries are memoized
+    CHECK(&constantPool.at(1) == &constantPool.at(1));
+
+    AeroJet::Java::ClassFile::ConstantPool modified = constantPool;
+    modified.insert({ 60, AeroJet::Java::ClassFile::ConstantPoolEntry::indices(AeroJet::Java::ClassFile::ConstantPoolInfoTag::CLASS, 1) });
+    CHECK_FALSE(modified.isLazy());
+    CHECK_EQ(modified.size(), 55);
+    CHECK(constantPool.isLazy());
+
+    // Embedded NUL is not valid modified UTF-8, it is only detected once the entry is decoded. Pools never start at
+    // offset 0 of a class file, so the entries follow a padding byte
+    const auto malformedBytes =
+        std::make_shared<const std::vector<AeroJet::u1>>(std::vector<AeroJet::u1>{ 0xCA, 0x01, 0x00, 0x01, 0x00, 0x07, 0x00, 0x01 });
+    AeroJet::Stream::ByteCursor malformedCursor{ *malformedBytes, malformedBytes };
+    malformedCursor.skip(1);
+    AeroJet::Java::ClassFile::ConstantPool malformed =
+        AeroJet::Java::ClassFile::ConstantPool::tryRead(malformedCursor, 3, AeroJet::Java::ClassFile::ConstantPool::Decoding::LAZY).value();
+    std::pair<AeroJet::u2, AeroJet::Java::ClassFile::ConstantPoolEntry> classEntry{
+        3, AeroJet::Java::ClassFile::ConstantPoolEntry::indices(AeroJet::Java::ClassFile::ConstantPoolInfoTag::CLASS, 1)
+    };
+    CHECK_THROWS_AS(malformed.insert(std::move(classEntry)), AeroJet::Exceptions::RuntimeException);
+    CHECK(malformed.isLazy());
+    CHECK_EQ(malformed.size(), 2);
+    CHECK(malformed.at(2).tag() == AeroJet::Java::ClassFile::ConstantPoolInfoTag::CLASS);
+
+    std::vector<AeroJet::u1> bytes = { lazy.bytes().begin(), lazy.bytes().end() };
+    bytes[10] = 0xFF;
+    const auto corrupted = AeroJet::Java::ClassFile::ClassInfo::tryLoad(bytes, AeroJet::Java::ClassFile::ConstantPool::Decoding::LAZY);
+    REQUIRE_FALSE(corrupted.hasValue());
+    CHECK(corrupted.error().code == AeroJet::Stream::ReadErrorCode::UNKNOWN_CONSTANT_POOL_TAG);
+    CHECK_EQ(corrupted.error().offset, 10);
+}
+
+TEST_CASE("AeroJet::Java::ClassFile::ConstantPool::Decoding::PARALLEL")
+{
+    // Synthetic class with a pool much larger than a single decoding chunk
+    constexpr AeroJet::u2 CONSTANT_POOL_COUNT = 30001;
+
+    AeroJet::Stream::ByteBuffer buffer;
+    buffer.write<AeroJet::u4>(AeroJet::Java::ClassFile::ClassInfo::JAVA_CLASS_MAGIC);
+    buffer.write<AeroJet::u2>(0);
+    buffer.write<AeroJet::u2>(52);
+    buffer.write<AeroJet::u2>(CONSTANT_POOL_COUNT);
+
+    std::size_t corruptedOffset = 0;
+    for(AeroJet::u2 index = 1; index < CONSTANT_POOL_COUNT; index++)
+    {
+        if(index % 3 == 1)
+        {
+            const std::string name = "generated/Name" + std::to_string(index);
+            buffer.write<AeroJet::u1>(static_cast<AeroJet::u1>(AeroJet::Java::ClassFile::ConstantPoolInfoTag::UTF_8));
+            buffer.write<AeroJet::u2>(static_cast<AeroJet::u2>(name.size()));
+            buffer.append(std::span<const AeroJet::u1>{ reinterpret_cast<const AeroJet::u1*>(name.data()), name.size() });
+        }
+        else if(index % 3 == 2)
+        {
+            buffer.write<AeroJet::u1>(static_cast<AeroJet::u1>(AeroJet::Java::ClassFile::ConstantPoolInfoTag::CLASS));
+            buffer.write<AeroJet::u2>(index - 1);
+        }
+        else
+        {
+            if(index == 25002)
+            {
+                corruptedOffset = buffer.size();
+            }
+            buffer.write<AeroJet::u1>(static_cast<AeroJet::u1>(AeroJet::Java::ClassFile::ConstantPoolInfoTag::INTEGER));
+            buffer.write<AeroJet::u4>(index);
+        }
+    }
+
+    buffer.write<AeroJet::u2>(0x0021);
+    buffer.write<AeroJet::u2>(2);
+    buffer.write<AeroJet::u2>(0);
+    for(std::size_t count = 0; count < 4; count++)
+    {
+        buffer.write<AeroJet::u2>(0);
+    }
+
+    const std::vector<AeroJet::u1> bytes = buffer.release();
+
+    const AeroJet::Java::ClassFile::ClassInfo eager = AeroJet::Java::ClassFile::ClassInfo::load(bytes);
+    const AeroJet::Java::ClassFile::ClassInfo parallel = AeroJet::Java::ClassFile::ClassInfo::load(bytes, AeroJet::Java::ClassFile::ConstantPool::Decoding::PARALLEL);
+
+    CHECK_EQ(parallel.constantPool().size(), CONSTANT_POOL_COUNT - 1);
+    CHECK_EQ(AeroJet::Java::ClassFile::Utils::ClassInfoUtils::name(parallel), "generated/Name1");
+    for(AeroJet::u2 index = 1; index < CONSTANT_POOL_COUNT; index++)
+    {
+        const AeroJet::Java::ClassFile::ConstantPoolEntry& entry = parallel.constantPool().at(index);
+        REQUIRE(entry.tag() == eager.constantPool().at(index).tag());
+        if(entry.tag() == AeroJet::Java::ClassFile::ConstantPoolInfoTag::UTF_8)
+        {
+            REQUIRE_EQ(parallel.constantPool().symbol(index), eager.constantPool().symbol(index));
+        }
+    }
+
+    std::vector<AeroJet::u1> corrupted = bytes;
+    // Same-sized UTF-8 entry with a stray continuation byte
+    corrupted[corruptedOffset] = static_cast<AeroJet::u1>(AeroJet::Java::ClassFile::ConstantPoolInfoTag::UTF_8);
+    corrupted[corruptedOffset + 1] = 0x00;
+    corrupted[corruptedOffset + 2] = 0x02;
+    corrupted[corruptedOffset + 3] = 0x80;
+    corrupted[corruptedOffset + 4] = 'a';
+
+    const auto eagerError = AeroJet::Java::ClassFile::ClassInfo::tryLoad(corrupted);
+    const auto parallelError = AeroJet::Java::ClassFile::ClassInfo::tryLoad(corrupted, AeroJet::Java::ClassFile::ConstantPool::Decoding::PARALLEL);
+    REQUIRE_FALSE(eagerError.hasValue());
+    REQUIRE_FALSE(parallelError.hasValue());
+    CHECK(parallelError.error().code == AeroJet::Stream::ReadErrorCode::MALFORMED_MODIFIED_UTF8);
+    CHECK(parallelError.error().code == eagerError.error().code);
+    CHECK_EQ(parallelError.error().offset, corruptedOffset + 3);
+    CHECK_EQ(parallelError.error().offset, eagerError.error().offset);
+}
+
+TEST_CASE("AeroJet::Java::ClassFile::ClassInfo::resolve")
+{
+    const AeroJet::Java::ClassFile::ClassInfo classInfo =
+        AeroJet::Java::ClassFile::ClassInfo::load("Resources/TestJavaBytecodeTableSwitch.class");
+
+    SUBCASE("Method reference")
+    {
+        const AeroJet::Java::ClassFile::ResolvedReference& reference = classInfo.resolve(1);
+        CHECK(reference.tag == AeroJet::Java::ClassFile::ConstantPoolInfoTag::METHOD_REF);
+        CHECK_EQ(reference.className.string, "java/lang/Object");
+        CHECK_EQ(reference.name.string, "<init>");
+        CHECK_EQ(reference.descriptor.string, "()V");
+
+        const auto* methodDescriptor = std::get_if<AeroJet::Java::ClassFile::MethodDescriptor>(&reference.parsedDescriptor);
+        REQUIRE(methodDescriptor != nullptr);
+        CHECK(methodDescriptor->arguments().empty());
+
+        // Memoized: same object, and the owner class is shared with the CLASS entry
+        CHECK_EQ(&classInfo.resolve(1), &reference);
+        CHECK_EQ(classInfo.resolve(14).className.id, reference.className.id);
+    }
+
+    SUBCASE("Field reference")
+    {
+        const AeroJet::Java::ClassFile::ResolvedReference& reference = classInfo.resolve(2);
+        CHECK(reference.tag == AeroJet::Java::ClassFile::ConstantPoolInfoTag::FIELD_REF);
+        CHECK_EQ(reference.className.string, "java/lang/System");
+        CHECK_EQ(reference.name.string, "out");
+        CHECK_EQ(reference.descriptor.string, "Ljava/io/PrintStream;");
+        CHECK(std::holds_alternative<AeroJet::Java::ClassFile::FieldDescriptor>(reference.parsedDescriptor));
+    }
+
+    SUBCASE("Copies share resolved references")
+    {
+        const AeroJet::Java::ClassFile::ResolvedReference& reference = classInfo.resolve(2);
+        const AeroJet::Java::ClassFile::ClassInfo copy = classInfo;
+        CHECK_EQ(&copy.resolve(2), &reference);
+    }
+
+    SUBCASE("Not a symbolic reference")
+    {
+        CHECK_THROWS_AS(static_cast<void>(classInfo.resolve(3)), AeroJet::Exceptions::RuntimeException);
+        CHECK_THROWS_AS(static_cast<void>(classInfo.resolve(0)), std::out_of_range);
+    }
+
+    SUBCASE("Member reference to entries of wrong kinds")
+    {
+        AeroJet::Java::ClassFile::ConstantPoolBuilder builder;
+        const AeroJet::u2 name = builder.utf8("name");
+        const AeroJet::u2 nameAndType = builder.nameAndType("name", "I");
+        const AeroJet::u2 classInfoIndex = builder.classInfo("Owner");
+        const AeroJet::u2 utf8Owner = builder.add(
+            AeroJet::Java::ClassFile::ConstantPoolEntry::indices(AeroJet::Java::ClassFile::ConstantPoolInfoTag::FIELD_REF, name, nameAndType));
+        const AeroJet::u2 classNameAndType = builder.add(
+            AeroJet::Java::ClassFile::ConstantPoolEntry::indices(AeroJet::Java::ClassFile::ConstantPoolInfoTag::FIELD_REF, classInfoIndex, classInfoIndex));
+        const AeroJet::u2 valid = builder.add(
+            AeroJet::Java::ClassFile::ConstantPoolEntry::indices(AeroJet::Java::ClassFile::ConstantPoolInfoTag::FIELD_REF, classInfoIndex, nameAndType));
+
+        const AeroJet::Java::ClassFile::ConstantPool constantPool = builder.build();
+        AeroJet::Java::ClassFile::ResolutionCache cache{ constantPool.slotCount() };
+        CHECK_THROWS_AS(static_cast<void>(cache.resolve(constantPool, utf8Owner)), AeroJet::Exceptions::RuntimeException);
+        CHECK_THROWS_AS(static_cast<void>(cache.resolve(constantPool, classNameAndType)), AeroJet::Exceptions::RuntimeException);
+        CHECK_EQ(cache.resolve(constantPool, valid).className.string, "Owner");
+    }
+}
+
+TEST_CASE("AeroJet::Java::ClassFile::Utils::ClassInfoUtils views")
+{
+    const std::string_view rawName = "org/project/Name";
+
+    AeroJet::Java::ClassFile::ConstantPool constantPool;
+    constantPool.reserve(3);
+    constantPool.insert({ 1, AeroJet::Java::ClassFile::ConstantPoolEntry::indices(AeroJet::Java::ClassFile::ConstantPoolInfoTag::CLASS, 2) });
+    constantPool.insert({ 2, AeroJet::Java::ClassFile::ConstantPoolEntry::utf8({ reinterpret_cast<const AeroJet::u1*>(rawName.data()), rawName.size() }) });
+
+    const AeroJet::Java::ClassFile::ClassInfo classInfo{ 0, 52, constantPool, 0, 1, std::nullopt, {}, {}, {}, {} };
+
+    const AeroJet::Java::ClassFile::ConstantPoolInfoUtf8 utf8 = classInfo.constantPool().at(2).as<AeroJet::Java::ClassFile::ConstantPoolInfoUtf8>();
+    CHECK_EQ(utf8.rawString(), rawName);
+    CHECK_EQ(utf8.rawBytes().size(), rawName.size());
+
+    std::string storage;
+    CHECK_EQ(utf8.asStringView(storage), rawName);
+    CHECK(storage.empty());
+
+    const std::string_view name = AeroJet::Java::ClassFile::Utils::ClassInfoUtils::nameView(classInfo);
+    CHECK_EQ(name, rawName);
+    CHECK_EQ(name.data(), utf8.rawString().data());
+    CHECK(AeroJet::Java::ClassFile::Utils::ClassInfoUtils::isUnderPackage(classInfo));
+
+    const std::string_view className = AeroJet::Java::ClassFile::Utils::ClassInfoUtils::classNameView(classInfo);
+    CHECK_EQ(className, "Name");
+    CHECK_EQ(className.data(), name.data() + name.size() - className.size());
+    CHECK_EQ(AeroJet::Java::ClassFile::Utils::ClassInfoUtils::className(classInfo), "Name");
+
+    // Views read the pool directly, without allocating the resolution cache
+    const std::size_t allocations = globalAllocations.load();
+    static_cast<void>(AeroJet::Java::ClassFile::Utils::ClassInfoUtils::nameView(classInfo));
+    static_cast<void>(AeroJet::Java::ClassFile::Utils::ClassInfoUtils::classNameView(classInfo));
+    CHECK_EQ(globalAllocations.load(), allocations);
+
+    SUBCASE("Trailing delimiter")
+    {
+        const std::string_view trailingName = "org/project/";
+
+        AeroJet::Java::ClassFile::ConstantPool trailingPool;
+        trailingPool.insert({ 1, AeroJet::Java::ClassFile::ConstantPoolEntry::indices(AeroJet::Java::ClassFile::ConstantPoolInfoTag::CLASS, 2) });
+        trailingPool.insert(
+            { 2, AeroJet::Java::ClassFile::ConstantPoolEntry::utf8({ reinterpret_cast<const AeroJet::u1*>(trailingName.data()), trailingName.size() }) });
+        const AeroJet::Java::ClassFile::ClassInfo trailing{ 0, 52, trailingPool, 0, 1, std::nullopt, {}, {}, {}, {} };
+
+        CHECK_EQ(AeroJet::Java::ClassFile::Utils::ClassInfoUtils::className(trailing), "project");
+        CHECK_EQ(AeroJet::Java::ClassFile::Utils::ClassInfoUtils::classNameView(trailing), "project");
+    }
+
+    CHECK_EQ(AeroJet::Java::ClassFile::Utils::ClassInfoUtils::javaName(classInfo, storage), "org.project.Name");
+    CHECK_EQ(AeroJet::Java::ClassFile::Utils::ClassInfoUtils::javaName(classInfo), "org.project.Name");
+}
+
+TEST_CASE("AeroJet::Java::ClassFile::Utils::ClassInfoUtils modified UTF-8 names")
+{
+    // U+0000 is encoded as C0 80 in modified UTF-8
+    const std::string_view rawName = "org/Nul\xC0\x80";
+    const std::string name{ "org/Nul\0", 8 };
+
+    AeroJet::Java::ClassFile::ConstantPool constantPool;
+    constantPool.reserve(3);
+    constantPool.insert({ 1, AeroJet::Java::ClassFile::ConstantPoolEntry::indices(AeroJet::Java::ClassFile::ConstantPoolInfoTag::CLASS, 2) });
+    constantPool.insert({ 2, AeroJet::Java::ClassFile::ConstantPoolEntry::utf8({ reinterpret_cast<const AeroJet::u1*>(rawName.data()), rawName.size() }) });
+
+    const AeroJet::Java::ClassFile::ClassInfo classInfo{ 0, 52, constantPool, 0, 1, std::nullopt, {}, {}, {}, {} };
+
+    CHECK_EQ(AeroJet::Java::ClassFile::Utils::ClassInfoUtils::nameView(classInfo), rawName);
+    CHECK_EQ(AeroJet::Java::ClassFile::Utils::ClassInfoUtils::name(classInfo), name);
+    CHECK_EQ(AeroJet::Java::ClassFile::Utils::ClassInfoUtils::className(classInfo), name.substr(4));
+
+    const std::string javaName{ "org.Nul\0", 8 };
+    std::string storage;
+    CHECK_EQ(AeroJet::Java::ClassFile::Utils::ClassInfoUtils::javaName(classInfo, storage), javaName);
+}
+
+TEST_CASE("AeroJet::Java::ClassFile::ClassHeader")
+{
+    const AeroJet::Java::ClassFile::ClassInfo classInfo =
+        AeroJet::Java::ClassFile::ClassInfo::load("Resources/TestJavaBytecodeTableSwitch.class");
+    const std::vector<AeroJet::u1> bytes{ classInfo.bytes().begin(), classInfo.bytes().end() };
+
+    SUBCASE("Load")
+    {
+        const AeroJet::Java::ClassFile::ClassHeader header =
+            AeroJet::Java::ClassFile::ClassHeader::load("Resources/TestJavaBytecodeTableSwitch.class");
+
+        CHECK(header.constantPool().isLazy());
+        CHECK_EQ(header.majorVersion(), classInfo.majorVersion());
+        CHECK(header.accessFlags() == classInfo.accessFlags());
+        CHECK_EQ(header.thisClass(), classInfo.thisClass());
+        CHECK_EQ(header.superClass(), classInfo.superClass());
+        CHECK_EQ(header.interfaces(), classInfo.interfaces());
+        CHECK_EQ(header.name(), "TestJavaBytecodeTableSwitch");
+        CHECK_EQ(header.superClassName(), "java/lang/Object");
+        CHECK(header.interfaceNames().empty());
+    }
+
+    SUBCASE("Stops at fields_count")
+    {
+        AeroJet::Stream::ByteCursor cursor{ bytes };
+        const auto header = AeroJet::Stream::Reader::read<AeroJet::Java::ClassFile::ClassHeader>(cursor);
+        CHECK_FALSE(header.constantPool().isLazy());
+        CHECK_EQ(cursor.readUnchecked<AeroJet::u2>(), classInfo.fields().size());
+    }
+
+    SUBCASE("Member tables are never read")
+    {
+        AeroJet::Stream::ByteCursor cursor{ bytes };
+        static_cast<void>(AeroJet::Stream::Reader::read<AeroJet::Java::ClassFile::ClassHeader>(cursor));
+
+        std::vector<AeroJet::u1> truncated{ bytes.begin(), bytes.begin() + static_cast<std::ptrdiff_t>(cursor.position()) };
+        CHECK_FALSE(AeroJet::Java::ClassFile::ClassInfo::tryLoad(truncated).hasValue());
+
+        const auto header = AeroJet::Java::ClassFile::ClassHeader::tryLoad(std::move(truncated));
+        REQUIRE(header.hasValue());
+        CHECK_EQ(header->name(), "TestJavaBytecodeTableSwitch");
+    }
+}
+
+namespace
+{
+    class CountingMemoryResource final : public std::pmr::memory_resource
+    {
+      public:
+        explicit CountingMemoryResource(std::pmr::memory_resource* upstream) :
+            m_upstream(upstream)
+        {
+        }
+
+        [[nodiscard]] std::size_t allocations() const
+        {
+            return m_allocations;
+        }
+
+      private:
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override
+        {
+            m_allocations++;
+            return m_upstream->allocate(bytes, alignment);
+        }
+
+        void do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) override
+        {
+            m_upstream->deallocate(pointer, bytes, alignment);
+        }
+
+        [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+        {
+            return this == &other;
+        }
+
+        std::pmr::memory_resource* m_upstream;
+        std::size_t m_allocations = 0;
+    };
+} // namespace
+
+TEST_CASE("AeroJet::Java::ClassFile::ClassInfo memory resource")
+{
+    std::ifstream inputFileStream{ "Resources/TestJavaBytecodeTableSwitch.class", std::ios::binary };
+    REQUIRE(inputFileStream.is_open());
+    const std::vector<AeroJet::u1> bytes{ std::istreambuf_iterator<char>(inputFileStream), std::istreambuf_iterator<char>() };
+
+    // Interns the symbols of the class, later parses only look them up
+    const AeroJet::Java::ClassFile::ClassInfo defaultInfo = AeroJet::Java::ClassFile::ClassInfo::load(bytes);
+
+    std::vector<std::byte> arenaBuffer(1 << 16);
+    std::pmr::monotonic_buffer_resource arena{ arenaBuffer.data(), arenaBuffer.size(), std::pmr::null_memory_resource() };
+    CountingMemoryResource memoryResource{ &arena };
+
+    // Without an owner of the bytes attribute payloads are copied into the arena as well
+    AeroJet::Stream::ByteCursor cursor{ bytes };
+    const std::size_t allocations = globalAllocations.load();
+    AeroJet::Stream::ReadResult<AeroJet::Java::ClassFile::ClassInfo> classInfo = AeroJet::Java::ClassFile::ClassInfo::tryRead(
+        cursor, AeroJet::Java::ClassFile::ConstantPool::Decoding::EAGER, &memoryResource);
+    const std::size_t parseGlobalAllocations = globalAllocations.load() - allocations;
+
+    REQUIRE(classInfo.hasValue());
+    CHECK_EQ(parseGlobalAllocations, 0);
+    CHECK_GT(memoryResource.allocations(), 0);
+    CHECK_EQ(classInfo->methods().size(), defaultInfo.methods().size());
+    CHECK_EQ(classInfo->attributes().size(), defaultInfo.attributes().size());
+
+    SUBCASE("Code decoded into the arena")
+    {
+        const AeroJet::Java::ClassFile::MethodInfo& method = classInfo->methods()[1];
+        const AeroJet::Java::ClassFile::AttributeInfo* codeInfo = method.findAttribute(AeroJet::Java::ClassFile::AttributeKind::CODE);
+        REQUIRE(codeInfo != nullptr);
+
+        const std::size_t arenaAllocations = memoryResource.allocations();
+        const AeroJet::Java::ClassFile::Code code{ classInfo->constantPool(), *codeInfo, AeroJet::Java::ClassFile::AttributeFilter::all(), &memoryResource };
+        CHECK_GT(memoryResource.allocations(), arenaAllocations);
+        CHECK_EQ(code.code().size(), method.code(classInfo->constantPool())->code().size());
+    }
+
+    SUBCASE("Copies do not depend on the arena")
+    {
+        const std::size_t arenaAllocations = memoryResource.allocations();
+        const AeroJet::Java::ClassFile::ClassInfo copy = classInfo.value();
+        CHECK_EQ(memoryResource.allocations(), arenaAllocations);
+        CHECK_EQ(copy.methods().size(), classInfo->methods().size());
+        CHECK_EQ(copy.constantPool().size(), classInfo->constantPool().size());
+    }
+}
+
+TEST_CASE("AeroJet::Java::ClassFile::ParserContext")
+{
+    CountingMemoryResource upstream{ std::pmr::new_delete_resource() };
+    AeroJet::Java::ClassFile::ParserContext context{ &upstream };
+
+    std::ifstream inputFileStream{ "Resources/TestJavaBytecodeTableSwitch.class", std::ios::binary };
+    REQUIRE(inputFileStream.is_open());
+    const std::vector<AeroJet::u1> bytes{ std::istreambuf_iterator<char>(inputFileStream), std::istreambuf_iterator<char>() };
+
+    {
+        const auto classInfo = context.tryParse(bytes);
+        REQUIRE(classInfo.hasValue());
+        CHECK_EQ(AeroJet::Java::ClassFile::Utils::ClassInfoUtils::name(*classInfo), "TestJavaBytecodeTableSwitch");
+    }
+
+    SUBCASE("Steady state parses do not reach upstream")
+    {
+        const std::size_t allocations = upstream.allocations();
+        const AeroJet::u1* bufferData = context.buffer().data();
+        for(int i = 0; i < 16; i++)
+        {
+            const std::size_t before = globalAllocations.load();
+            const AeroJet::Java::ClassFile::ClassInfo classInfo = context.tryParse(bytes).value();
+            const std::size_t parsed = globalAllocations.load() - before;
+
+            CHECK_EQ(parsed, 0);
+            CHECK_EQ(classInfo.bytes().data(), bufferData);
+        }
+
+        CHECK_EQ(upstream.allocations(), allocations);
+    }
+
+    SUBCASE("Parsed classes outlive the context of their thread")
+    {
+        std::optional<AeroJet::Java::ClassFile::ClassInfo> parsed;
+        std::thread parser{ [&parsed, &bytes]() { parsed.emplace(AeroJet::Java::ClassFile::ParserContext::local().tryParse(bytes).value()); } };
+        parser.join();
+
+        REQUIRE(parsed.has_value());
+        CHECK_EQ(AeroJet::Java::ClassFile::Utils::ClassInfoUtils::name(*parsed), "TestJavaBytecodeTableSwitch");
+        CHECK_EQ(parsed->methods().size(), 2);
+    }
+
+    SUBCASE("Buffer is not reused while a class borrows it")
+    {
+        const AeroJet::Java::ClassFile::ClassInfo first = context.tryParse(bytes).value();
+        const AeroJet::Java::ClassFile::ClassInfo second = context.tryParse(bytes).value();
+        CHECK_NE(first.bytes().data(), second.bytes().data());
+        CHECK_EQ(first.methods().size(), second.methods().size());
+    }
+}
+
+namespace
+{
+    class CountingVisitor : public AeroJet::Java::ClassFile::ClassVisitor, public AeroJet::Java::ClassFile::MethodVisitor
+    {
+      public:
+        explicit CountingVisitor(bool visitCode) :
+            m_visitCode(visitCode)
+        {
+        }
+
+        void visitHeader(const AeroJet::Java::ClassFile::ClassHeader& header) override
+        {
+            m_className = header.name();
+        }
+
+        AeroJet::Java::ClassFile::MethodVisitor* visitMethod(AeroJet::u2 /*accessFlags*/, std::string_view name, std::string_view /*descriptor*/) override
+        {
+            m_methodNames.emplace_back(name);
+            return this;
+        }
+
+        void visitAttribute(std::string_view /*name*/, const AeroJet::Java::ClassFile::AttributeInfo& attribute) override
+        {
+            m_attributes++;
+            m_unknownAttributes += attribute.kind() == AeroJet::Java::ClassFile::AttributeKind::UNKNOWN ? 1 : 0;
+        }
+
+        bool visitCode(AeroJet::u2 /*maxStack*/, AeroJet::u2 /*maxLocals*/, AeroJet::u4 codeLength) override
+        {
+            m_codeLength += codeLength;
+            return m_visitCode;
+        }
+
+        void visitInstruction(AeroJet::u4 offset, const AeroJet::Java::ByteCode::Instruction& instruction) override
+        {
+            m_instructions++;
+            m_lastOffset = offset;
+            m_operands.emplace_back(instruction.data());
+        }
+
+        void visitCodeAttribute(std::string_view /*name*/, const AeroJet::Java::ClassFile::AttributeInfo& attribute) override
+        {
+            m_codeAttributes++;
+            m_unknownAttributes += attribute.kind() == AeroJet::Java::ClassFile::AttributeKind::UNKNOWN ? 1 : 0;
+        }
+
+        void visitEnd() override
+        {
+            m_ends++;
+        }
+
+        bool m_visitCode;
+        std::string m_className;
+        std::vector<std::string> m_methodNames;
+        std::size_t m_attributes = 0;
+        std::size_t m_codeLength = 0;
+        std::size_t m_instructions = 0;
+        std::size_t m_codeAttributes = 0;
+        std::size_t m_unknownAttributes = 0;
+        std::size_t m_ends = 0;
+        std::vector<std::vector<AeroJet::u1>> m_operands;
+        AeroJet::u4 m_lastOffset = 0;
+    };
+} // namespace
+
+TEST_CASE("AeroJet::Java::ClassFile::ClassReader")
+{
+    std::ifstream inputFileStream{ "Resources/TestJavaBytecodeTableSwitch.class", std::ios::binary };
+    REQUIRE(inputFileStream.is_open());
+    const auto bytes = std::make_shared<const std::vector<AeroJet::u1>>(std::istreambuf_iterator<char>(inputFileStream), std::istreambuf_iterator<char>());
+
+    const AeroJet::Java::ClassFile::ClassInfo classInfo = AeroJet::Java::ClassFile::ClassInfo::load("Resources/TestJavaBytecodeTableSwitch.class");
+
+    std::size_t instructions = 0;
+    std::size_t codeAttributes = 0;
+    std::vector<std::vector<AeroJet::u1>> operands;
+    for(const auto& method : classInfo.methods())
+    {
+        const AeroJet::Java::ClassFile::Code code{ classInfo.constantPool(), method.attributes()[0] };
+        instructions += code.code().size();
+        codeAttributes += code.attributes().size();
+        for(const AeroJet::Java::ByteCode::Instruction& instruction : code.code())
+        {
+            operands.emplace_back(instruction.data());
+        }
+    }
+
+    SUBCASE("Events match the tree")
+    {
+        CountingVisitor visitor{ true };
+        const AeroJet::Java::ClassFile::ClassReader reader{ *bytes, bytes };
+        REQUIRE_FALSE(reader.accept(visitor).has_value());
+
+        CHECK_EQ(visitor.m_className, "TestJavaBytecodeTableSwitch");
+        REQUIRE_EQ(visitor.m_methodNames.size(), classInfo.methods().size());
+        CHECK_EQ(visitor.m_methodNames[0], "<init>");
+        CHECK_EQ(visitor.m_methodNames[1], "tableSwitchTest");
+        CHECK_EQ(visitor.m_attributes, classInfo.attributes().size());
+        CHECK_EQ(visitor.m_instructions, instructions);
+        CHECK_EQ(visitor.m_codeAttributes, codeAttributes);
+        CHECK_LT(visitor.m_lastOffset, visitor.m_codeLength);
+
+        // Every attribute of the class is a standard one, Code included as it is reported through visitCode
+        CHECK_EQ(visitor.m_unknownAttributes, 0);
+
+        // Operands are assembled in one buffer shared by all instructions of the class
+        CHECK(visitor.m_operands == operands);
+
+        // Every method and the class itself
+        CHECK_EQ(visitor.m_ends, classInfo.methods().size() + 1);
+    }
+
+    SUBCASE("Skipped code")
+    {
+        CountingVisitor visitor{ false };
+        const AeroJet::Java::ClassFile::ClassReader reader{ *bytes };
+        REQUIRE_FALSE(reader.accept(visitor).has_value());
+
+        CHECK_EQ(visitor.m_methodNames.size(), classInfo.methods().size());
+        CHECK_GT(visitor.m_codeLength, 0);
+        CHECK_EQ(visitor.m_instructions, 0);
+        CHECK_EQ(visitor.m_codeAttributes, 0);
+    }
+
+    SUBCASE("Truncated class")
+    {
+        const std::span<const AeroJet::u1> truncated{ bytes->data(), bytes->size() - 4 };
+
+        CountingVisitor visitor{ true };
+        const AeroJet::Java::ClassFile::ClassReader reader{ truncated };
+        const std::optional<AeroJet::Stream::ReadError> error = reader.accept(visitor);
+        REQUIRE(error.has_value());
+        CHECK(error->code == AeroJet::Stream::ReadErrorCode::UNEXPECTED_END);
+        CHECK_EQ(visitor.m_className, "TestJavaBytecodeTableSwitch");
+        CHECK_EQ(visitor.m_ends, classInfo.methods().size());
+    }
+
+    SUBCASE("Invalid attribute name index")
+    {
+        // The class ends with its last attribute, whose name index precedes the u4 length and the payload
+        const std::size_t nameIndexOffset = bytes->size() - classInfo.attributes().back().info().size() - sizeof(AeroJet::u4) - sizeof(AeroJet::u2);
+        std::vector<AeroJet::u1> corrupted = *bytes;
+        corrupted[nameIndexOffset] = 0xFF;
+        corrupted[nameIndexOffset + 1] = 0xFF;
+
+        CountingVisitor visitor{ true };
+        const AeroJet::Java::ClassFile::ClassReader reader{ corrupted };
+        const std::optional<AeroJet::Stream::ReadError> error = reader.accept(visitor);
+        REQUIRE(error.has_value());
+        CHECK(error->code == AeroJet::Stream::ReadErrorCode::INVALID_CONSTANT_POOL_INDEX);
+        CHECK_EQ(error->offset, nameIndexOffset);
+        CHECK_EQ(visitor.m_ends, classInfo.methods().size());
+    }
+}
+
+TEST_CASE("AeroJet::Java::ClassFile::AttributeFilter")
+{
+    const AeroJet::Java::ClassFile::AttributeFilter frontEndFilter{ "Code", "StackMapTable", "BootstrapMethods", "ConstantValue", "Exceptions" };
+    CHECK_FALSE(frontEndFilter.keepsAll());
+    CHECK(frontEndFilter.keeps("Code"));
+    CHECK_FALSE(frontEndFilter.keeps("LineNumberTable"));
+    CHECK(AeroJet::Java::ClassFile::AttributeFilter::all().keeps("LineNumberTable"));
+
+    const AeroJet::Java::ClassFile::ClassInfo full = AeroJet::Java::ClassFile::ClassInfo::load("Resources/TestJavaBytecodeTableSwitch.class");
+
+    SUBCASE("Only kept attributes are materialized")
+    {
+        const AeroJet::Java::ClassFile::ClassInfo classInfo = AeroJet::Java::ClassFile::ClassInfo::load(
+            "Resources/TestJavaBytecodeTableSwitch.class",
+            AeroJet::Java::ClassFile::ConstantPool::Decoding::EAGER,
+            std::pmr::get_default_resource(),
+            frontEndFilter);
+
+        // SourceFile
+        CHECK_EQ(full.attributes().size(), 1);
+        CHECK(classInfo.attributes().empty());
+
+        REQUIRE_EQ(classInfo.methods().size(), full.methods().size());
+        for(std::size_t methodIndex = 0; methodIndex < classInfo.methods().size(); methodIndex++)
+        {
+            const auto& method = classInfo.methods()[methodIndex];
+            REQUIRE_EQ(method.attributes().size(), 1);
+            CHECK_EQ(AeroJet::Java::ClassFile::Utils::AttributeInfoUtils::extractNameView(classInfo.constantPool(), method.attributes()[0]), "Code");
+
+            const AeroJet::Java::ClassFile::Code fullCode{ full.constantPool(), full.methods()[methodIndex].attributes()[0] };
+            const AeroJet::Java::ClassFile::Code code{ classInfo.constantPool(), method.attributes()[0], frontEndFilter };
+            CHECK_EQ(code.code().size(), fullCode.code().size());
+            CHECK_LT(code.attributes().size(), fullCode.attributes().size());
+            for(const auto& attribute : code.attributes())
+            {
+                CHECK_EQ(AeroJet::Java::ClassFile::Utils::AttributeInfoUtils::extractNameView(classInfo.constantPool(), attribute), "StackMapTable");
+            }
+        }
+    }
+
+    SUBCASE("Empty filter drops every attribute")
+    {
+        const AeroJet::Java::ClassFile::ClassInfo classInfo = AeroJet::Java::ClassFile::ClassInfo::load(
+            "Resources/TestJavaBytecodeTableSwitch.class",
+            AeroJet::Java::ClassFile::ConstantPool::Decoding::LAZY,
+            std::pmr::get_default_resource(),
+            AeroJet::Java::ClassFile::AttributeFilter::none());
+
+        CHECK(classInfo.attributes().empty());
+        for(const auto& method : classInfo.methods())
+        {
+            CHECK(method.attributes().empty());
+        }
+    }
+
+    SUBCASE("ParserContext")
+    {
+        AeroJet::Java::ClassFile::ParserContext context;
+        context.setAttributeFilter(frontEndFilter);
+
+        std::ifstream inputFileStream{ "Resources/TestJavaBytecodeTableSwitch.class", std::ios::binary };
+        REQUIRE(inputFileStream.is_open());
+
+        const AeroJet::Java::ClassFile::ClassInfo classInfo = context.tryParse(inputFileStream).value();
+        CHECK(classInfo.attributes().empty());
+        CHECK_EQ(classInfo.methods()[0].attributes().size(), 1);
+    }
+}
+
+TEST_CASE("AeroJet::Java::ClassFile::AttributeKind")
+{
+    CHECK(AeroJet::Java::ClassFile::attributeKind("Code") == AeroJet::Java::ClassFile::AttributeKind::CODE);
+    CHECK(AeroJet::Java::ClassFile::attributeKind("NoSuchAttribute") == AeroJet::Java::ClassFile::AttributeKind::UNKNOWN);
+    CHECK_EQ(AeroJet::Java::ClassFile::attributeKindName(AeroJet::Java::ClassFile::AttributeKind::STACK_MAP_TABLE), "StackMapTable");
+
+    const AeroJet::Java::ClassFile::ClassInfo classInfo = AeroJet::Java::ClassFile::ClassInfo::load("Resources/TestJavaBytecodeTableSwitch.class");
+
+    // Kinds agree with the names in the constant pool
+    for(const auto& attribute : classInfo.attributes())
+    {
+        CHECK_EQ(AeroJet::Java::ClassFile::attributeKindName(attribute.kind()),
+                 AeroJet::Java::ClassFile::Utils::AttributeInfoUtils::extractNameView(classInfo.constantPool(), attribute));
+    }
+
+    const AeroJet::Java::ClassFile::AttributeInfo* sourceFile = classInfo.findAttribute(AeroJet::Java::ClassFile::AttributeKind::SOURCE_FILE);
+    REQUIRE(sourceFile != nullptr);
+    CHECK_EQ(sourceFile, &classInfo.attributes()[0]);
+    CHECK(classInfo.findAttribute(AeroJet::Java::ClassFile::AttributeKind::CODE) == nullptr);
+
+    for(const auto& method : classInfo.methods())
+    {
+        const AeroJet::Java::ClassFile::AttributeInfo* codeInfo = method.findAttribute(AeroJet::Java::ClassFile::AttributeKind::CODE);
+        REQUIRE(codeInfo != nullptr);
+        CHECK(codeInfo->kind() == AeroJet::Java::ClassFile::AttributeKind::CODE);
+
+        const AeroJet::Java::ClassFile::Code code{ classInfo.constantPool(), *codeInfo };
+        for(const auto& attribute : code.attributes())
+        {
+            CHECK(attribute.kind() != AeroJet::Java::ClassFile::AttributeKind::UNKNOWN);
+        }
+
+        CHECK_THROWS_AS(static_cast<void>(AeroJet::Java::ClassFile::SourceFile{ classInfo.constantPool(), *codeInfo }),
+                        AeroJet::Exceptions::IncorrectAttributeTypeException);
+    }
+
+    SUBCASE("Uncached resolver")
+    {
+        AeroJet::Java::ClassFile::AttributeKindResolver resolver{ classInfo.constantPool() };
+
+        const std::size_t allocations = globalAllocations.load();
+        AeroJet::Java::ClassFile::AttributeKindResolver uncached = AeroJet::Java::ClassFile::AttributeKindResolver::uncached(classInfo.constantPool());
+        for(AeroJet::u2 index = 0; index < classInfo.constantPool().slotCount() + 1; index++)
+        {
+            CHECK(uncached.resolve(index) == resolver.resolve(index));
+        }
+        CHECK_EQ(globalAllocations.load(), allocations);
+    }
+
+    SUBCASE("Attributes read without a constant pool")
+    {
+        const AeroJet::Java::ClassFile::AttributeInfo detached{ sourceFile->attributeNameIndex(), sourceFile->copyInfo() };
+        CHECK(detached.kind() == AeroJet::Java::ClassFile::AttributeKind::UNKNOWN);
+
+        const AeroJet::Java::ClassFile::SourceFile attribute{ classInfo.constantPool(), detached };
+        CHECK_EQ(attribute.attributeNameIndex(), sourceFile->attributeNameIndex());
+    }
+
+    SUBCASE("Dropped attributes are not found")
+    {
+        const AeroJet::Java::ClassFile::ClassInfo filtered = AeroJet::Java::ClassFile::ClassInfo::load(
+            "Resources/TestJavaBytecodeTableSwitch.class",
+            AeroJet::Java::ClassFile::ConstantPool::Decoding::EAGER,
+            std::pmr::get_default_resource(),
+            AeroJet::Java::ClassFile::AttributeFilter::none());
+
+        CHECK(filtered.findAttribute(AeroJet::Java::ClassFile::AttributeKind::SOURCE_FILE) == nullptr);
+        CHECK(filtered.methods()[0].findAttribute(AeroJet::Java::ClassFile::AttributeKind::CODE) == nullptr);
+    }
+}
+
+TEST_CASE("AeroJet::Java::ClassFile::MethodInfo::code")
+{
+    const AeroJet::Java::ClassFile::ClassInfo classInfo = AeroJet::Java::ClassFile::ClassInfo::load("Resources/TestJavaBytecodeTableSwitch.class");
+    const AeroJet::Java::ClassFile::ConstantPool& constantPool = classInfo.constantPool();
+    const AeroJet::Java::ClassFile::MethodInfo& tableSwitchTest = classInfo.methods()[1];
+
+    const AeroJet::Java::ClassFile::Code* code = tableSwitchTest.code(constantPool);
+    REQUIRE(code != nullptr);
+    CHECK_EQ(tableSwitchTest.code(constantPool), code);
+
+    const AeroJet::Java::ClassFile::Code expected{ constantPool, tableSwitchTest.attributes()[0] };
+    CHECK_EQ(code->code().size(), expected.code().size());
+    CHECK_EQ(code->exceptionTable().size(), expected.exceptionTable().size());
+    CHECK_EQ(code->attributes().size(), expected.attributes().size());
+
+    const AeroJet::Java::ClassFile::LineNumberTable* lineNumberTable = tableSwitchTest.lineNumberTable(constantPool);
+    REQUIRE(lineNumberTable != nullptr);
+    CHECK_FALSE(lineNumberTable->lineNumberTable().empty());
+    CHECK_EQ(tableSwitchTest.lineNumberTable(constantPool), lineNumberTable);
+
+    // Only the method with the switch needs frames
+    CHECK(tableSwitchTest.stackMapTable(constantPool) != nullptr);
+    CHECK(classInfo.methods()[0].stackMapTable(constantPool) == nullptr);
+
+    SUBCASE("Concurrent callers share one decoding")
+    {
+        const AeroJet::Java::ClassFile::ClassInfo fresh = AeroJet::Java::ClassFile::ClassInfo::load("Resources/TestJavaBytecodeTableSwitch.class");
+
+        std::vector<const AeroJet::Java::ClassFile::Code*> results(4, nullptr);
+        std::vector<std::thread> threads;
+        for(std::size_t threadIndex = 0; threadIndex < results.size(); threadIndex++)
+        {
+            threads.emplace_back([&fresh, &results, threadIndex]()
+                                 { results[threadIndex] = fresh.methods()[1].code(fresh.constantPool()); });
+        }
+
+        for(auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        REQUIRE(results[0] != nullptr);
+        for(const auto* result : results)
+        {
+            CHECK_EQ(result, results[0]);
+        }
+    }
+
+    SUBCASE("Concurrent callers on a class parsed with the thread local context")
+    {
+        std::ifstream inputFileStream{ "Resources/TestJavaBytecodeTableSwitch.class", std::ios::binary };
+        REQUIRE(inputFileStream.is_open());
+        const std::vector<AeroJet::u1> bytes{ std::istreambuf_iterator<char>(inputFileStream), std::istreambuf_iterator<char>() };
+
+        const AeroJet::Java::ClassFile::ClassInfo parsed = AeroJet::Java::ClassFile::ParserContext::local().tryParse(bytes).value();
+
+        std::vector<const AeroJet::Java::ClassFile::Code*> results(4, nullptr);
+        std::vector<std::thread> threads;
+        for(std::size_t threadIndex = 0; threadIndex < results.size(); threadIndex++)
+        {
+            threads.emplace_back([&parsed, &results, threadIndex]()
+                                 { results[threadIndex] = parsed.methods()[1].code(parsed.constantPool()); });
+        }
+
+        for(auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        REQUIRE(results[0] != nullptr);
+        for(const auto* result : results)
+        {
+            CHECK_EQ(result, results[0]);
+        }
+
+        CHECK_EQ(results[0]->code().size(), code->code().size());
+    }
+
+    SUBCASE("Moved-from methods decode again")
+    {
+        AeroJet::Java::ClassFile::MethodInfo source = tableSwitchTest;
+        const AeroJet::Java::ClassFile::Code* sourceCode = source.code(constantPool);
+
+        const AeroJet::Java::ClassFile::MethodInfo moved = std::move(source);
+        CHECK_EQ(moved.code(constantPool), sourceCode);
+
+        // Moving leaves the attributes table empty
+        CHECK(source.code(constantPool) == nullptr);
+
+        source = tableSwitchTest;
+        const AeroJet::Java::ClassFile::Code* reassignedCode = source.code(constantPool);
+        REQUIRE(reassignedCode != nullptr);
+        CHECK_EQ(reassignedCode->code().size(), code->code().size());
+    }
+
+    SUBCASE("Copies decode on their own")
+    {
+        const AeroJet::Java::ClassFile::MethodInfo copy = tableSwitchTest;
+        const AeroJet::Java::ClassFile::Code* copyCode = copy.code(constantPool);
+        REQUIRE(copyCode != nullptr);
+        CHECK_NE(copyCode, code);
+        CHECK_EQ(copyCode->code().size(), code->code().size());
+    }
+
+    SUBCASE("Dropped Code")
+    {
+        const AeroJet::Java::ClassFile::ClassInfo filtered = AeroJet::Java::ClassFile::ClassInfo::load(
+            "Resources/TestJavaBytecodeTableSwitch.class",
+            AeroJet::Java::ClassFile::ConstantPool::Decoding::EAGER,
+            std::pmr::get_default_resource(),
+            AeroJet::Java::ClassFile::AttributeFilter::none());
+
+        CHECK(filtered.methods()[1].code(filtered.constantPool()) == nullptr);
+        CHECK(filtered.methods()[1].lineNumberTable(filtered.constantPool()) == nullptr);
+    }
+
+    SUBCASE("Attributes without kinds")
+    {
+        const AeroJet::Java::ClassFile::AttributeInfo& codeInfo = tableSwitchTest.attributes()[0];
+
+        // Name indices of attributes read without a constant pool are unchecked
+        std::pmr::vector<AeroJet::Java::ClassFile::AttributeInfo> attributes;
+        attributes.emplace_back(0xFFFF, std::vector<AeroJet::u1>{});
+        attributes.emplace_back(tableSwitchTest.nameIndex(), std::vector<AeroJet::u1>{});
+        attributes.emplace_back(codeInfo.attributeNameIndex(), codeInfo.copyInfo());
+
+        const AeroJet::Java::ClassFile::MethodInfo method{ 0,
+                                                           tableSwitchTest.nameIndex(),
+                                                           tableSwitchTest.descriptorIndex(),
+                                                           std::move(attributes) };
+        const AeroJet::Java::ClassFile::Code* methodCode = method.code(constantPool);
+        REQUIRE(methodCode != nullptr);
+        CHECK_EQ(methodCode->code().size(), code->code().size());
+    }
+}
@@ -0,0 +1,176 @@
+/*
+ * ConstantPoolBuilder.cpp
+ *
+ * Copyright © 2024 AeroJet Developers. All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the “Software”), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+ * OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+
+#include "AeroJet.hpp"
+#include "doctest.h"
+
+#include <string>
+
+namespace
+{
+    AeroJet::Java::ClassFile::ConstantPool readBack(const AeroJet::Java::ClassFile::ConstantPoolBuilder& builder)
+    {
+        AeroJet::Stream::ByteBuffer buffer;
+        builder.writeTo(buffer);
+
+        AeroJet::Stream::ByteCursor cursor{ buffer.bytes() };
+        const auto constantPoolCount = cursor.readUnchecked<AeroJet::u2>();
+        auto constantPool = AeroJet::Java::ClassFile::ConstantPool::tryRead(cursor, constantPoolCount);
+        REQUIRE(constantPool.hasValue());
+        CHECK_EQ(cursor.remaining(), 0);
+
+        return std::move(constantPool).value();
+    }
+} // namespace
+
+TEST_CASE("AeroJet::Java::ClassFile::ConstantPoolBuilder")
+{
+    AeroJet::Java::ClassFile::ConstantPoolBuilder builder;
+
+    const AeroJet::u2 println = builder.memberRef(AeroJet::Java::ClassFile::ConstantPoolInfoTag::METHOD_REF,
+                                                  "java/io/PrintStream", "println", "(Ljava/lang/String;)V");
+    const AeroJet::u2 wide = builder.add(AeroJet::Java::ClassFile::ConstantPoolEntry::wideValue(
+        AeroJet::Java::ClassFile::ConstantPoolInfoTag::LONG, 1, 2));
+    const AeroJet::u2 hello = builder.string("hello");
+
+    SUBCASE("Entries are deduplicated")
+    {
+        const AeroJet::u2 count = builder.count();
+        const AeroJet::u2 secondPrintln = builder.memberRef(AeroJet::Java::ClassFile::ConstantPoolInfoTag::METHOD_REF,
+                                                           "java/io/PrintStream", "println", "(Ljava/lang/String;)V");
+        CHECK_EQ(secondPrintln, println);
+        CHECK_EQ(builder.classInfo("java/io/PrintStream"), builder.at(println).as<AeroJet::Java::ClassFile::ConstantPoolInfoMethodRef>().classIndex());
+        CHECK_EQ(builder.count(), count);
+        CHECK_EQ(builder.useCount(println), 2);
+
+        // Interface method reference with the same operands is a different entry
+        const AeroJet::u2 interfaceRef = builder.memberRef(AeroJet::Java::ClassFile::ConstantPoolInfoTag::INTERFACE_METHOD_REF,
+                                                          "java/io/PrintStream", "println", "(Ljava/lang/String;)V");
+        CHECK_NE(interfaceRef, println);
+        CHECK_EQ(builder.count(), count + 1);
+    }
+
+    SUBCASE("LONG and DOUBLE take two slots")
+    {
+        CHECK_EQ(hello, wide + 3);
+        CHECK_THROWS_AS(static_cast<void>(builder.at(wide + 1)), std::out_of_range);
+
+        const AeroJet::Java::ClassFile::ConstantPool constantPool = readBack(builder);
+        CHECK_EQ(constantPool.slotCount(), builder.count());
+        CHECK_FALSE(constantPool.contains(wide + 1));
+        CHECK_EQ(constantPool.at(wide).as<AeroJet::Java::ClassFile::ConstantPoolInfoLong>().lowBytes(), 2);
+    }
+
+    SUBCASE("Written pool reads back")
+    {
+        const AeroJet::Java::ClassFile::ConstantPool constantPool = readBack(builder);
+        const AeroJet::Java::ClassFile::ConstantPool built = builder.build();
+        CHECK_EQ(constantPool.size(), built.size());
+
+        for(const auto& [index, entry] : built)
+        {
+            CHECK(constantPool.at(index).tag() == entry.tag());
+            CHECK_EQ(constantPool.at(index).contentKey(), entry.contentKey());
+        }
+
+        const AeroJet::u2 nameIndex = constantPool.at(hello).as<AeroJet::Java::ClassFile::ConstantPoolInfoString>().stringIndex();
+        CHECK_EQ(constantPool.at(nameIndex).as<AeroJet::Java::ClassFile::ConstantPoolInfoUtf8>().rawString(), "hello");
+    }
+
+    SUBCASE("Ordering by frequency")
+    {
+        const AeroJet::u4 helloUses = builder.useCount(hello) + 10;
+        for(int i = 0; i < 10; i++)
+        {
+            static_cast<void>(builder.string("hello"));
+        }
+
+        const std::vector<AeroJet::u2> indexMap = builder.orderByFrequency();
+        // "hello" and its UTF-8 entry are the most used entries
+        const AeroJet::u2 newHello = indexMap[hello];
+        CHECK_LT(newHello, 3);
+        CHECK_EQ(indexMap[wide] + 2, builder.count());
+        CHECK_EQ(builder.useCount(newHello), helloUses);
+
+        const AeroJet::u2 newPrintln = indexMap[println];
+        const auto methodRef = builder.at(newPrintln).as<AeroJet::Java::ClassFile::ConstantPoolInfoMethodRef>();
+        const AeroJet::u2 classNameIndex = builder.at(methodRef.classIndex()).as<AeroJet::Java::ClassFile::ConstantPoolInfoClass>().nameIndex();
+        CHECK_EQ(builder.at(classNameIndex).as<AeroJet::Java::ClassFile::ConstantPoolInfoUtf8>().rawString(), "java/io/PrintStream");
+
+        // Lookups keep working with the rewritten entries
+        CHECK_EQ(builder.string("hello"), newHello);
+        CHECK_EQ(builder.memberRef(AeroJet::Java::ClassFile::ConstantPoolInfoTag::METHOD_REF,
+                                   "java/io/PrintStream", "println", "(Ljava/lang/String;)V"),
+                 newPrintln);
+    }
+
+    SUBCASE("Loadable constants are ordered before other entries")
+    {
+        AeroJet::Java::ClassFile::ConstantPoolBuilder namesBuilder;
+        const AeroJet::u2 frequent = namesBuilder.string("frequent");
+        static_cast<void>(namesBuilder.string("frequent"));
+
+        // Names used more often than the strings, enough of them to fill the range of ldc
+        for(int i = 0; i < 300; i++)
+        {
+            const std::string name = "name" + std::to_string(i);
+            static_cast<void>(namesBuilder.utf8(name));
+            static_cast<void>(namesBuilder.utf8(name));
+            static_cast<void>(namesBuilder.utf8(name));
+        }
+        const AeroJet::u2 rare = namesBuilder.string("rare");
+        CHECK_GT(rare, 255);
+
+        const std::vector<AeroJet::u2> indexMap = namesBuilder.orderByFrequency();
+        CHECK_EQ(indexMap[frequent], 1);
+        CHECK_EQ(indexMap[rare], 2);
+        CHECK_EQ(namesBuilder.string("rare"), 2);
+    }
+}
+
+TEST_CASE("AeroJet::Java::ClassFile::ConstantPoolBuilder from ConstantPool")
+{
+    const AeroJet::Java::ClassFile::ClassInfo classInfo =
+        AeroJet::Java::ClassFile::ClassInfo::load("Resources/TestJavaBytecodeTableSwitch.class");
+    const AeroJet::Java::ClassFile::ConstantPool& constantPool = classInfo.constantPool();
+
+    AeroJet::Java::ClassFile::ConstantPoolBuilder builder{ constantPool };
+    CHECK_EQ(builder.count(), constantPool.slotCount());
+
+    // Existing entries keep their indices, new ones are appended
+    CHECK_EQ(builder.utf8("java/lang/Object"), 43);
+    CHECK_EQ(builder.memberRef(AeroJet::Java::ClassFile::ConstantPoolInfoTag::FIELD_REF,
+                               "java/lang/System", "out", "Ljava/io/PrintStream;"),
+             2);
+    CHECK_EQ(builder.count(), constantPool.slotCount());
+
+    const AeroJet::u2 added = builder.utf8("added");
+    CHECK_EQ(added, constantPool.slotCount());
+
+    const AeroJet::Java::ClassFile::ConstantPool rewritten = readBack(builder);
+    CHECK_EQ(rewritten.size(), constantPool.size() + 1);
+    CHECK_EQ(rewritten.at(42).as<AeroJet::Java::ClassFile::ConstantPoolInfoUtf8>().rawString(), "TestJavaBytecodeTableSwitch");
+}
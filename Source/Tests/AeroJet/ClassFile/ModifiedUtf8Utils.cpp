@@ -0,0 +1,138 @@
+/*
+ * ModifiedUtf8Utils.cpp
+ *
+ * Copyright © 2024 AeroJet Developers. All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the “Software”), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+ * OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+
+#include "AeroJet.hpp"
+#include "doctest.h"
+
+#include <string>
+#include <vector>
+
+namespace
+{
+    std::vector<AeroJet::u1> toBytes(std::string_view string)
+    {
+        return { string.begin(), string.end() };
+    }
+} // namespace
+
+TEST_CASE("AeroJet::Java::ClassFile::Utils::ModifiedUtf8Utils")
+{
+    using AeroJet::Java::ClassFile::Utils::ModifiedUtf8Utils;
+
+    SUBCASE("ASCII")
+    {
+        const std::vector<AeroJet::u1> bytes = toBytes("java/lang/invoke/LambdaMetafactory.metafactory:(Ljava/lang/Object;)V");
+
+        CHECK(ModifiedUtf8Utils::isAscii(bytes));
+        CHECK_FALSE(ModifiedUtf8Utils::validate(bytes).has_value());
+
+        std::string storage;
+        const std::string_view string = ModifiedUtf8Utils::toUtf8(bytes, storage);
+        CHECK(string.data() == reinterpret_cast<const char*>(bytes.data()));
+        CHECK(storage.empty());
+        CHECK_EQ(ModifiedUtf8Utils::toUtf16(bytes).size(), bytes.size());
+    }
+
+    SUBCASE("ASCII prefix length")
+    {
+        for(std::size_t position = 0; position < 70; position++)
+        {
+            std::vector<AeroJet::u1> bytes(70, 'a');
+            bytes[position] = 0xC3;
+            CHECK_EQ(ModifiedUtf8Utils::asciiLength(bytes), position);
+
+            bytes[position] = 0x00;
+            CHECK_EQ(ModifiedUtf8Utils::asciiLength(bytes), position);
+        }
+    }
+
+    SUBCASE("Encoded NUL")
+    {
+        const std::vector<AeroJet::u1> bytes{ 'a', 0xC0, 0x80, 'b' };
+
+        CHECK_FALSE(ModifiedUtf8Utils::isAscii(bytes));
+        CHECK_FALSE(ModifiedUtf8Utils::validate(bytes).has_value());
+        CHECK_EQ(ModifiedUtf8Utils::toUtf8(bytes), std::string("a\0b", 3));
+        CHECK(ModifiedUtf8Utils::toUtf16(bytes) == std::u16string(u"a\0b", 3));
+    }
+
+    SUBCASE("Two and three byte characters")
+    {
+        // "Привет, мир €"
+        const std::vector<AeroJet::u1> bytes = toBytes("\xD0\x9F\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82, \xD0\xBC\xD0\xB8\xD1\x80 \xE2\x82\xAC");
+
+        CHECK_FALSE(ModifiedUtf8Utils::validate(bytes).has_value());
+        CHECK_EQ(ModifiedUtf8Utils::toUtf8(bytes), std::string(bytes.begin(), bytes.end()));
+        CHECK(ModifiedUtf8Utils::toUtf16(bytes) == u"Привет, мир €");
+    }
+
+    SUBCASE("Surrogate pairs")
+    {
+        // U+1F600 is encoded as surrogates D83D DE00
+        const std::vector<AeroJet::u1> bytes{ 'x', 0xED, 0xA0, 0xBD, 0xED, 0xB8, 0x80, 'y' };
+
+        CHECK_FALSE(ModifiedUtf8Utils::validate(bytes).has_value());
+        CHECK_EQ(ModifiedUtf8Utils::toUtf8(bytes), "x\xF0\x9F\x98\x80y");
+        CHECK(ModifiedUtf8Utils::toUtf16(bytes) == u"x\U0001F600y");
+
+        const std::vector<AeroJet::u1> unpaired{ 0xED, 0xA0, 0xBD, 'z' };
+        CHECK_FALSE(ModifiedUtf8Utils::validate(unpaired).has_value());
+        CHECK_EQ(ModifiedUtf8Utils::toUtf8(unpaired), "\xEF\xBF\xBDz");
+    }
+
+    SUBCASE("Malformed")
+    {
+        CHECK_EQ(ModifiedUtf8Utils::validate(std::vector<AeroJet::u1>{ 'a', 0x00 }).value(), 1);
+        CHECK_EQ(ModifiedUtf8Utils::validate(std::vector<AeroJet::u1>{ 'a', 'b', 0x80 }).value(), 2);
+        CHECK_EQ(ModifiedUtf8Utils::validate(std::vector<AeroJet::u1>{ 0xC1, 0x81 }).value(), 0);
+        CHECK_EQ(ModifiedUtf8Utils::validate(std::vector<AeroJet::u1>{ 0xE0, 0x80, 0x80 }).value(), 0);
+        CHECK_EQ(ModifiedUtf8Utils::validate(std::vector<AeroJet::u1>{ 0xF0, 0x9F, 0x98, 0x80 }).value(), 0);
+        CHECK_EQ(ModifiedUtf8Utils::validate(std::vector<AeroJet::u1>{ 'a', 0xE2, 0x82 }).value(), 1);
+        CHECK_THROWS_AS(static_cast<void>(ModifiedUtf8Utils::toUtf8(std::vector<AeroJet::u1>{ 0xFF })), AeroJet::Exceptions::RuntimeException);
+        CHECK_THROWS_AS(static_cast<void>(ModifiedUtf8Utils::toUtf16(std::vector<AeroJet::u1>{ 0xFF })), AeroJet::Exceptions::RuntimeException);
+    }
+
+    SUBCASE("Constant Pool Entry")
+    {
+        const std::vector<AeroJet::u1> entry{ 0x01, 0x00, 0x03, 'a', 0xC0, 0x80 };
+        AeroJet::Stream::ByteCursor cursor{ entry };
+
+        const auto constantPoolEntry = AeroJet::Stream::Reader::tryRead<AeroJet::Java::ClassFile::ConstantPoolEntry>(cursor);
+        REQUIRE(constantPoolEntry.hasValue());
+
+        const AeroJet::Java::ClassFile::ConstantPoolInfoUtf8 utf8 = constantPoolEntry->as<AeroJet::Java::ClassFile::ConstantPoolInfoUtf8>();
+        CHECK_EQ(utf8.length(), 3);
+        CHECK_EQ(utf8.asString(), std::string("a\0", 2));
+
+        const std::vector<AeroJet::u1> malformedEntry{ 0x01, 0x00, 0x02, 'a', 0x80 };
+        AeroJet::Stream::ByteCursor malformedCursor{ malformedEntry };
+
+        const auto malformedConstantPoolEntry = AeroJet::Stream::Reader::tryRead<AeroJet::Java::ClassFile::ConstantPoolEntry>(malformedCursor);
+        REQUIRE_FALSE(malformedConstantPoolEntry.hasValue());
+        CHECK(malformedConstantPoolEntry.error().code == AeroJet::Stream::ReadErrorCode::MALFORMED_MODIFIED_UTF8);
+        CHECK_EQ(malformedConstantPoolEntry.error().offset, 4);
+    }
+}
@@ -0,0 +1,99 @@
+/*
+ * SymbolTable.cpp
+ *
+ * Copyright © 2024 AeroJet Developers. All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the “Software”), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+ * OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+
+#include "AeroJet.hpp"
+#include "doctest.h"
+
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST_CASE("AeroJet::Java::ClassFile::SymbolTable")
+{
+    SUBCASE("Interning")
+    {
+        AeroJet::Java::ClassFile::SymbolTable symbolTable;
+
+        const AeroJet::Java::ClassFile::Symbol object = symbolTable.intern("java/lang/Object");
+        const AeroJet::Java::ClassFile::Symbol init = symbolTable.intern("<init>");
+        const std::string objectCopy = "java/lang/Object";
+
+        CHECK_NE(object.id, init.id);
+        CHECK_EQ(symbolTable.intern(objectCopy).id, object.id);
+        CHECK(symbolTable.intern(objectCopy).string.data() == object.string.data());
+        CHECK_EQ(symbolTable.symbol(init.id), "<init>");
+        CHECK_EQ(symbolTable.find("java/lang/Object").value(), object.id);
+        CHECK_FALSE(symbolTable.find("java/lang/String").has_value());
+        CHECK_EQ(symbolTable.size(), 2);
+        CHECK_THROWS_AS(static_cast<void>(symbolTable.symbol(0xFFFFFFFF)), AeroJet::Exceptions::RuntimeException);
+    }
+
+    SUBCASE("Concurrent interning")
+    {
+        AeroJet::Java::ClassFile::SymbolTable symbolTable;
+
+        constexpr std::size_t THREADS_COUNT = 8;
+        constexpr std::size_t SYMBOLS_COUNT = 1000;
+
+        std::vector<std::vector<AeroJet::Java::ClassFile::SymbolId>> ids(THREADS_COUNT);
+        std::vector<std::thread> threads;
+        for(std::size_t threadIndex = 0; threadIndex < THREADS_COUNT; threadIndex++)
+        {
+            threads.emplace_back([&symbolTable, &ids, threadIndex]()
+                                 {
+                                     for(std::size_t symbolIndex = 0; symbolIndex < SYMBOLS_COUNT; symbolIndex++)
+                                     {
+                                         ids[threadIndex].push_back(symbolTable.intern("symbol" + std::to_string(symbolIndex)).id);
+                                     } });
+        }
+
+        for(std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        CHECK_EQ(symbolTable.size(), SYMBOLS_COUNT);
+        for(std::size_t threadIndex = 1; threadIndex < THREADS_COUNT; threadIndex++)
+        {
+            CHECK(ids[threadIndex] == ids[0]);
+        }
+
+        CHECK_EQ(symbolTable.symbol(ids[0][42]), "symbol42");
+    }
+
+    SUBCASE("Shared between classes")
+    {
+        const AeroJet::Java::ClassFile::ClassInfo first = AeroJet::Java::ClassFile::ClassInfo::load("Resources/TestJavaBytecodeTableSwitch.class");
+        const AeroJet::Java::ClassFile::ClassInfo second = AeroJet::Java::ClassFile::ClassInfo::load("Resources/TestExceptionsAttribute.class");
+
+        const AeroJet::Java::ClassFile::SymbolId firstCode = first.constantPool().symbol(first.methods()[0].attributes()[0].attributeNameIndex());
+        const AeroJet::Java::ClassFile::SymbolId secondCode = second.constantPool().symbol(second.methods()[0].attributes()[0].attributeNameIndex());
+
+        CHECK_EQ(firstCode, secondCode);
+        CHECK_EQ(AeroJet::Java::ClassFile::SymbolTable::global().symbol(firstCode), "Code");
+    }
+}
@@ -0,0 +1,84 @@
+/*
+ * ByteBuffer.cpp
+ *
+ * Copyright © 2024 AeroJet Developers. All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the “Software”), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+ * OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+
+#include "AeroJet.hpp"
+#include "doctest.h"
+
+TEST_CASE("AeroJet::Stream::ByteBuffer::write")
+{
+    AeroJet::Stream::ByteBuffer buffer;
+
+    buffer.write(AeroJet::u1{ 0xCA });
+    buffer.write(AeroJet::u2{ 0xFEBA });
+    buffer.write<AeroJet::Stream::ByteOrder::DEFAULT>(AeroJet::u2{ 0x0102 });
+    buffer.write(AeroJet::i4{ -2 });
+
+    REQUIRE_EQ(buffer.size(), 9);
+
+    AeroJet::Stream::ByteCursor cursor{ buffer.bytes() };
+    CHECK_EQ(cursor.read<AeroJet::u1>(), 0xCA);
+    CHECK_EQ(cursor.read<AeroJet::u2>(), 0xFEBA);
+
+    AeroJet::u2 nativeValue;
+    std::memcpy(&nativeValue, cursor.readBytes(sizeof(nativeValue)).data(), sizeof(nativeValue));
+    CHECK_EQ(nativeValue, 0x0102);
+
+    CHECK_EQ(cursor.read<AeroJet::i4>(), -2);
+}
+
+TEST_CASE("AeroJet::Stream::ByteBuffer::writeArray")
+{
+    std::vector<AeroJet::u4> values(37);
+    for(std::size_t index = 0; index < values.size(); index++)
+    {
+        values[index] = static_cast<AeroJet::u4>(index * 0x01010101u + 0x00020406u);
+    }
+
+    AeroJet::Stream::ByteBuffer buffer{ 4 };
+    buffer.write(AeroJet::u1{ 0x00 });
+    buffer.writeArray(std::span<const AeroJet::u4>{ values });
+
+    AeroJet::Stream::ByteCursor cursor{ buffer.bytes() };
+    cursor.skip(1);
+    CHECK(cursor.readArray<AeroJet::u4>(values.size()) == values);
+    CHECK(cursor.eof());
+}
+
+TEST_CASE("AeroJet::Stream::ByteBuffer::release")
+{
+    AeroJet::Stream::ByteBuffer buffer{ 64 };
+    CHECK_EQ(buffer.capacity(), 64);
+
+    const std::vector<AeroJet::u1> bytes{ 0xDE, 0xAD, 0xFA, 0xCE };
+    buffer.append(bytes);
+
+    std::stringstream stream;
+    buffer.writeTo(stream);
+    CHECK_EQ(stream.str(), "\xDE\xAD\xFA\xCE");
+
+    CHECK(buffer.release() == bytes);
+    CHECK(buffer.empty());
+}
@@ -0,0 +1,105 @@
+/*
+ * ByteCursor.cpp
+ *
+ * Copyright © 2024 AeroJet Developers. All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the “Software”), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+ * OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+
+#include "AeroJet.hpp"
+#include "doctest.h"
+
+TEST_CASE("AeroJet::Stream::ByteCursor::read")
+{
+    const std::vector<AeroJet::u1> bytes{ 0xCA, 0xFE, 0xBA, 0xBE, 0x00, 0x34, 0xFF };
+    AeroJet::Stream::ByteCursor cursor{ bytes };
+
+    REQUIRE_EQ(cursor.read<AeroJet::u4>(), AeroJet::Java::ClassFile::ClassInfo::JAVA_CLASS_MAGIC);
+    REQUIRE_EQ(cursor.read<AeroJet::u2>(), 52);
+    REQUIRE_EQ(cursor.read<AeroJet::i1>(), -1);
+
+    REQUIRE(cursor.eof());
+    REQUIRE_EQ(cursor.position(), bytes.size());
+}
+
+TEST_CASE("AeroJet::Stream::ByteCursor::require")
+{
+    const std::vector<AeroJet::u1> bytes{ 0x00, 0x01, 0x02 };
+    AeroJet::Stream::ByteCursor cursor{ bytes };
+
+    CHECK_NOTHROW(cursor.require(3));
+    CHECK_THROWS_AS(cursor.require(4), AeroJet::Exceptions::RuntimeException);
+
+    CHECK_EQ(cursor.read<AeroJet::u2>(), 0x0001);
+    CHECK_THROWS_AS(static_cast<void>(cursor.read<AeroJet::u2>()), AeroJet::Exceptions::RuntimeException);
+    CHECK_EQ(cursor.remaining(), 1);
+}
+
+TEST_CASE("AeroJet::Stream::ByteCursor::readBytes")
+{
+    const std::vector<AeroJet::u1> bytes{ 0xDE, 0xAD, 0xFA, 0xCE };
+    AeroJet::Stream::ByteCursor cursor{ bytes };
+
+    cursor.skip(1);
+    const std::span<const AeroJet::u1> view = cursor.readBytes(2);
+
+    REQUIRE_EQ(view.size(), 2);
+    REQUIRE_EQ(view.data(), bytes.data() + 1);
+    REQUIRE_EQ(cursor.read<AeroJet::u1>(), 0xCE);
+}
+
+TEST_CASE("AeroJet::Stream::ByteCursor::readArray")
+{
+    std::vector<AeroJet::u1> bytes(256 + 3);
+    for(std::size_t index = 0; index < bytes.size(); index++)
+    {
+        bytes[index] = static_cast<AeroJet::u1>(index * 7 + 1);
+    }
+
+    // Unaligned start and lengths around the 16/32 byte vector widths exercise both vector and scalar tails
+    for(std::size_t count = 0; count <= 64; count++)
+    {
+        AeroJet::Stream::ByteCursor u2Cursor{ std::span<const AeroJet::u1>{ bytes }.subspan(1) };
+        AeroJet::Stream::ByteCursor u2ExpectedCursor{ std::span<const AeroJet::u1>{ bytes }.subspan(1) };
+
+        const std::vector<AeroJet::u2> u2Values = u2Cursor.readArray<AeroJet::u2>(count);
+        REQUIRE_EQ(u2Values.size(), count);
+        for(const AeroJet::u2 value : u2Values)
+        {
+            REQUIRE_EQ(value, u2ExpectedCursor.read<AeroJet::u2>());
+        }
+        REQUIRE_EQ(u2Cursor.position(), u2ExpectedCursor.position());
+
+        AeroJet::Stream::ByteCursor i4Cursor{ std::span<const AeroJet::u1>{ bytes }.subspan(3) };
+        AeroJet::Stream::ByteCursor i4ExpectedCursor{ std::span<const AeroJet::u1>{ bytes }.subspan(3) };
+
+        const std::vector<AeroJet::i4> i4Values = i4Cursor.readArray<AeroJet::i4>(count);
+        REQUIRE_EQ(i4Values.size(), count);
+        for(const AeroJet::i4 value : i4Values)
+        {
+            REQUIRE_EQ(value, i4ExpectedCursor.read<AeroJet::i4>());
+        }
+    }
+
+    AeroJet::Stream::ByteCursor cursor{ bytes };
+    CHECK_THROWS_AS(static_cast<void>(cursor.readArray<AeroJet::u4>(bytes.size())), AeroJet::Exceptions::RuntimeException);
+    CHECK_EQ(cursor.position(), 0);
+}
@@ -33,3 +33,28 @@ TEST_CASE("AeroJet::Stream::Utils::bytesToStream")
     AeroJet::u4 readData = AeroJet::Stream::Reader::read<AeroJet::u4>(stream, AeroJet::Stream::ByteOrder::INVERSE);
     REQUIRE_EQ(readData, AeroJet::Java::ClassFile::ClassInfo::JAVA_CLASS_MAGIC);
 }
+
+TEST_CASE("AeroJet::Stream::Reader::read compile-time byte order")
+{
+    std::stringstream stream = AeroJet::Stream::Utils::bytesToStream({ 0xCA, 0xFE, 0xBA, 0xBE, 0x00, 0x34, 0xFF });
+
+    CHECK_EQ((AeroJet::Stream::Reader::read<AeroJet::u4, AeroJet::Stream::ByteOrder::INVERSE>(stream)),
+             AeroJet::Java::ClassFile::ClassInfo::JAVA_CLASS_MAGIC);
+    CHECK_EQ((AeroJet::Stream::Reader::read<AeroJet::u2, AeroJet::Stream::ByteOrder::INVERSE>(stream)), 0x34);
+    CHECK_EQ((AeroJet::Stream::Reader::read<AeroJet::u1, AeroJet::Stream::ByteOrder::DEFAULT>(stream)), 0xFF);
+    CHECK_THROWS_AS(static_cast<void>(AeroJet::Stream::Reader::read<AeroJet::u2, AeroJet::Stream::ByteOrder::DEFAULT>(stream)),
+                    AeroJet::Exceptions::RuntimeException);
+}
+
+TEST_CASE("AeroJet::Stream::swapEndian")
+{
+    CHECK_EQ(AeroJet::Stream::swapEndian(AeroJet::u1{ 0xCA }), 0xCA);
+    CHECK_EQ(AeroJet::Stream::swapEndian(AeroJet::u2{ 0xCAFE }), 0xFECA);
+    CHECK_EQ(AeroJet::Stream::swapEndian(AeroJet::u4{ 0xCAFEBABE }), 0xBEBAFECA);
+    CHECK_EQ(AeroJet::Stream::swapEndian(AeroJet::u8{ 0x0102030405060708 }), 0x0807060504030201);
+    CHECK_EQ(AeroJet::Stream::swapEndian(AeroJet::i2{ -2 }), static_cast<AeroJet::i2>(0xFEFF));
+    CHECK_EQ(AeroJet::Stream::swapEndian(AeroJet::Stream::swapEndian(1.5)), 1.5);
+
+    const AeroJet::u1 bytes[] = { 0xCA, 0xFE, 0xBA, 0xBE };
+    CHECK_EQ(AeroJet::Stream::loadBigEndian<AeroJet::u4>(bytes), 0xCAFEBABE);
+}
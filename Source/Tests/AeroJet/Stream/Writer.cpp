@@ -50,4 +50,13 @@ TEST_CASE("AeroJet::Stream::Writer::write")
         READ_TEST(AeroJet::u4, 0xFFFFFFFF)
         READ_TEST(AeroJet::u8, 0xFFFFFFFFFFFFFFFF)
     }
+
+    SUBCASE("Compile-time byte order")
+    {
+        AeroJet::Stream::Writer::write<AeroJet::Stream::ByteOrder::INVERSE>(ss, AeroJet::u2{ 0xCAFE });
+        AeroJet::Stream::Writer::write<AeroJet::Stream::ByteOrder::DEFAULT>(ss, AeroJet::u2{ 0xCAFE });
+
+        READ_TEST(AeroJet::u2, 0xFECA)
+        READ_TEST(AeroJet::u2, 0xCAFE)
+    }
 }